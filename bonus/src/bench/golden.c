@@ -0,0 +1,160 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Lit un pixel de la fenêtre telle qu'elle est présentée.
+ *
+ * La minimap est une image à part, placée en (MINIMAP_POS, MINIMAP_POS)
+ * par-dessus la vue 3D: ses pixels remplacent ceux de l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param x Coordonnée X dans la fenêtre.
+ * @param y Coordonnée Y dans la fenêtre.
+ * @return La couleur du pixel (0xRRGGBB).
+ */
+static unsigned int	window_pixel(t_Cub3d *cub, int x, int y)
+{
+	t_ImageControl	*img;
+	t_MiniMap		*m;
+
+	m = cub->minimap;
+	img = cub->img;
+	if (x >= MINIMAP_POS && y >= MINIMAP_POS
+		&& x < MINIMAP_POS + m->width && y < MINIMAP_POS + m->height)
+	{
+		img = m->img;
+		x -= MINIMAP_POS;
+		y -= MINIMAP_POS;
+	}
+	return (*(unsigned int *)(img->addr + y * img->len + x * 4));
+}
+
+/**
+ * @brief Calcule un pixel de la vignette, moyenne d'un bloc de la fenêtre.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param x Coordonnée X du coin du bloc dans la fenêtre.
+ * @param y Coordonnée Y du coin du bloc dans la fenêtre.
+ * @param dst Reçoit les trois composantes RGB du pixel.
+ */
+static void	thumb_pixel(t_Cub3d *cub, int x, int y, unsigned char *dst)
+{
+	unsigned int	px;
+	int				sum[3];
+	int				i;
+
+	ft_bzero(sum, sizeof(sum));
+	i = 0;
+	while (i < GOLDEN_SCALE * GOLDEN_SCALE)
+	{
+		px = window_pixel(cub, x + i % GOLDEN_SCALE, y + i / GOLDEN_SCALE);
+		sum[0] += px >> 16 & 255;
+		sum[1] += px >> 8 & 255;
+		sum[2] += px & 255;
+		i++;
+	}
+	dst[0] = sum[0] / (GOLDEN_SCALE * GOLDEN_SCALE);
+	dst[1] = sum[1] / (GOLDEN_SCALE * GOLDEN_SCALE);
+	dst[2] = sum[2] / (GOLDEN_SCALE * GOLDEN_SCALE);
+}
+
+/**
+ * @brief Réduit la fenêtre rendue en vignette de GOLDEN_W x GOLDEN_H pixels.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param out Reçoit les pixels RGB de la vignette.
+ */
+static void	golden_thumb(t_Cub3d *cub, unsigned char *out)
+{
+	int	x;
+	int	y;
+
+	y = 0;
+	while (y < GOLDEN_H)
+	{
+		x = 0;
+		while (x < GOLDEN_W)
+		{
+			thumb_pixel(cub, x * GOLDEN_SCALE, y * GOLDEN_SCALE,
+				out + (y * GOLDEN_W + x) * 3);
+			x++;
+		}
+		y++;
+	}
+}
+
+/**
+ * @brief Compare la frame rendue à son image de référence et affiche le
+ * résultat.
+ *
+ * Une empreinte identique signifie une frame identique au pixel près. Sinon,
+ * les vignettes sont comparées: la frame est acceptée tant que moins de
+ * GOLDEN_MAX_PERMILLE pour mille des pixels s'écartent de plus de GOLDEN_TOL.
+ * Les références sont rendues par le moteur en virgule flottante: le
+ * moteur FIXED_POINT, exact là où le flottant arrondit (murs et texels
+ * touchés pile sur une limite, fréquents dans les poses de départ), a droit
+ * à 15 pour mille.
+ *
+ * @param b Pointeur vers le banc d'essai.
+ * @param hash L'empreinte de la frame rendue.
+ */
+static void	golden_compare(t_Bench *b, unsigned long long hash)
+{
+	unsigned long long	ref;
+	int					off;
+
+	if (golden_read(b->path, &ref, b->ref))
+	{
+		printf("missing or invalid golden image, FAILED\n");
+		b->failed++;
+		return ;
+	}
+	if (ref == hash)
+	{
+		printf("exact\n");
+		return ;
+	}
+	off = golden_diff(b->thumb, b->ref);
+	printf("%d/%d px off", off, GOLDEN_W * GOLDEN_H);
+	if (off * 1000 > GOLDEN_MAX_PERMILLE * GOLDEN_W * GOLDEN_H)
+	{
+		printf(", FAILED\n");
+		b->failed++;
+	}
+	else
+		printf(", within tolerance\n");
+}
+
+/**
+ * @brief Vérifie une frame du banc d'essai contre son image de référence.
+ *
+ * La fonction 'golden_check' calcule l'empreinte de la frame complète (vue
+ * 3D, HUD et minimap) et sa vignette, puis les compare à l'image de
+ * référence de la pose, ou la réécrit avec '--golden-update'. La durée de
+ * rendu de la pose est affichée avec le résultat.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param frame L'index de la frame rendue.
+ */
+void	golden_check(t_Cub3d *cub, int frame)
+{
+	t_Bench				*b;
+	unsigned long long	hash;
+
+	b = cub->bench;
+	hash = frame_hash(cub->img, cub->win->width, cub->win->height,
+			FNV_OFFSET);
+	hash = frame_hash(cub->minimap->img, cub->minimap->width,
+			cub->minimap->height, hash);
+	golden_thumb(cub, b->thumb);
+	golden_path(cub, frame);
+	printf("golden: %s: %.3f ms, ", b->path, b->times[frame] / 1e6);
+	if (!cub->opt->golden_update)
+		golden_compare(b, hash);
+	else if (golden_write(b->path, hash, b->thumb))
+	{
+		printf("write failed\n");
+		b->failed++;
+	}
+	else
+		printf("written\n");
+}
@@ -0,0 +1,123 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Alloue les vignettes de la comparaison aux images de référence.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès ou sans '--golden', 1 si l'allocation échoue.
+ */
+int	golden_init(t_Cub3d *cub)
+{
+	if (!cub->opt->golden)
+		return (0);
+	cub->bench->thumb = malloc(GOLDEN_W * GOLDEN_H * 3);
+	cub->bench->ref = malloc(GOLDEN_W * GOLDEN_H * 3);
+	return (!cub->bench->thumb || !cub->bench->ref);
+}
+
+/**
+ * @brief Construit le chemin de l'image de référence d'une frame.
+ *
+ * Le chemin est '<dossier>/<carte>_NN.ppm', où <carte> est le nom du fichier
+ * de carte sans son dossier ni son extension '.cub'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param frame L'index de la frame.
+ */
+void	golden_path(t_Cub3d *cub, int frame)
+{
+	char	*name;
+	size_t	len;
+
+	name = ft_strrchr(cub->opt->map_file, '/');
+	if (name)
+		name++;
+	else
+		name = cub->opt->map_file;
+	len = ft_strlen(name);
+	if (len > 4 && !ft_strncmp(name + len - 4, ".cub", 5))
+		len -= 4;
+	snprintf(cub->bench->path, PATH_MAX, "%s/%.*s_%02d.ppm",
+		cub->opt->golden, (int)len, name, frame);
+}
+
+/**
+ * @brief Lit une image de référence.
+ *
+ * L'image est un PPM (P6) de GOLDEN_W x GOLDEN_H pixels dont le commentaire
+ * porte l'empreinte FNV-1a de la frame complète.
+ *
+ * @param path Le chemin de l'image.
+ * @param hash Reçoit l'empreinte de la frame complète.
+ * @param buf Reçoit les pixels RGB de la vignette.
+ * @return 0 en cas de succès, 1 si l'image est absente ou invalide.
+ */
+int	golden_read(char *path, unsigned long long *hash, unsigned char *buf)
+{
+	FILE	*f;
+	int		w;
+	int		h;
+	int		ok;
+
+	f = fopen(path, "rb");
+	if (!f)
+		return (1);
+	ok = fscanf(f, "P6 # fnv %llx %d %d 255%*c", hash, &w, &h) == 3
+		&& w == GOLDEN_W && h == GOLDEN_H
+		&& fread(buf, GOLDEN_W * GOLDEN_H * 3, 1, f) == 1;
+	fclose(f);
+	return (!ok);
+}
+
+/**
+ * @brief Écrit une image de référence.
+ *
+ * @param path Le chemin de l'image.
+ * @param hash L'empreinte de la frame complète.
+ * @param buf Les pixels RGB de la vignette.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+int	golden_write(char *path, unsigned long long hash, unsigned char *buf)
+{
+	FILE	*f;
+	int		ok;
+
+	f = fopen(path, "wb");
+	if (!f)
+		return (1);
+	ok = fprintf(f, "P6\n# fnv %016llx\n%d %d\n255\n", hash, GOLDEN_W,
+			GOLDEN_H) > 0 && fwrite(buf, GOLDEN_W * GOLDEN_H * 3, 1, f) == 1;
+	if (fclose(f))
+		ok = 0;
+	return (!ok);
+}
+
+/**
+ * @brief Compte les pixels différents entre deux vignettes.
+ *
+ * Un pixel est différent si l'une de ses composantes s'écarte de plus de
+ * GOLDEN_TOL de la référence.
+ *
+ * @param a La vignette rendue.
+ * @param b La vignette de référence.
+ * @return Le nombre de pixels différents.
+ */
+int	golden_diff(unsigned char *a, unsigned char *b)
+{
+	int	off;
+	int	i;
+
+	off = 0;
+	i = 0;
+	while (i < GOLDEN_W * GOLDEN_H)
+	{
+		if (ft_abs(a[0] - b[0]) > GOLDEN_TOL
+			|| ft_abs(a[1] - b[1]) > GOLDEN_TOL
+			|| ft_abs(a[2] - b[2]) > GOLDEN_TOL)
+			off++;
+		a += 3;
+		b += 3;
+		i++;
+	}
+	return (off);
+}
@@ -28,8 +28,10 @@ void	cam_utils_init(t_CameraConfig *cam)
  * @brief Initialise la configuration de la caméra.
  *
  * Cette fonction initialise la structure de configuration de la caméra,
- * en définissant le champ de vision (FOV) sur une valeur par défaut
- * et en marquant la caméra comme valide.
+ * en définissant le champ de vision (FOV) sur une valeur par défaut,
+ * en marquant la caméra comme valide et en allouant les tables des impacts
+ * et des directions de rayon (une entrée par colonne de l'écran), ainsi que
+ * le cache des tables de lignes de texture.
  *
  * @param cub Pointeur vers la structure principale du jeu (t_Cub3d).
  * @return Renvoie 0 en cas de succès, ou 1 si l'allocation de mémoire échoue.
@@ -41,5 +43,9 @@ int	camera_init(t_Cub3d *cub)
 		return (1);
 	cub->cam->fov = 1;
 	cub->cam_ok = true;
+	cub->cam->hits = ft_calloc(cub->win->width, sizeof(t_RayHit));
+	cub->cam->rays = ft_calloc(cub->win->width, sizeof(t_RayDir));
+	if (!cub->cam->hits || !cub->cam->rays || scaler_init(cub))
+		return (1);
 	return (0);
 }
\ No newline at end of file
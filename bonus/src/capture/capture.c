@@ -0,0 +1,146 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Ouvre le flux Y4M et écrit son en-tête, ou vérifie le préfixe PPM.
+ *
+ * Un nom terminé par '.y4m' désigne un flux unique au format YUV4MPEG2
+ * (4:2:0, plage complète), lisible par ffmpeg ou mpv. Tout autre nom est le
+ * préfixe des fichiers PPM, complété par le numéro de la frame.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param c Pointeur vers la capture.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+static int	capture_open(t_Cub3d *cub, t_Capture *c)
+{
+	size_t	len;
+	int		fps;
+
+	c->name = cub->opt->capture;
+	len = ft_strlen(c->name);
+	c->y4m = len > 4 && !ft_strncmp(c->name + len - 4, ".y4m", 5);
+	if (!c->y4m)
+		return (len + 16 > PATH_MAX);
+	c->fd = open(c->name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (c->fd < 0)
+		return (1);
+	fps = cub->opt->target_fps;
+	if (fps <= 0)
+		fps = TARGET_FPS;
+	if (dprintf(c->fd, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+			c->w, c->h, fps) < 0)
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Prépare la capture des frames et démarre le thread d'écriture.
+ *
+ * La fonction 'capture_init' ne fait rien sans l'option '--capture'. Toute la
+ * mémoire de la capture (l'anneau de CAPTURE_SLOTS tampons et le tampon
+ * d'encodage) est allouée ici: ensuite, capturer une frame n'alloue plus rien.
+ * Les frames ont la taille de la fenêtre, arrondie à un nombre pair de
+ * pixels pour le sous-échantillonnage 4:2:0 du flux Y4M.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+int	capture_init(t_Cub3d *cub)
+{
+	t_Capture	*c;
+
+	if (!cub->opt->capture)
+		return (0);
+	c = ft_calloc(1, sizeof(t_Capture));
+	cub->capture = c;
+	if (!c)
+		return (1);
+	c->fd = -1;
+	c->trace = cub->trace;
+	c->w = cub->win->width & ~1;
+	c->h = cub->win->height & ~1;
+	c->ring = malloc((size_t)CAPTURE_SLOTS * c->w * c->h * 4);
+	c->out = malloc((size_t)c->w * c->h * 3);
+	if (!c->ring || !c->out || capture_open(cub, c)
+		|| sem_init(&c->ready, 0, 0))
+		return (1);
+	if (pthread_create(&c->thread, NULL, capture_main, c))
+	{
+		sem_destroy(&c->ready);
+		return (1);
+	}
+	c->started = true;
+	return (0);
+}
+
+/**
+ * @brief Copie la frame rendue dans l'anneau de la capture.
+ *
+ * La fonction 'capture_frame' est appelée par le rendu après la présentation
+ * de chaque frame. Elle ne bloque jamais: si le thread d'écriture n'a pas
+ * encore libéré de tampon, la frame est perdue et comptée. Sinon, les lignes
+ * visibles de l'image du jeu sont copiées dans le tampon suivant, qui est
+ * publié en avançant 'head' puis en postant le sémaphore.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	capture_frame(t_Cub3d *cub)
+{
+	t_Capture		*c;
+	long long		head;
+	unsigned int	*dst;
+	int				y;
+
+	c = cub->capture;
+	if (!c)
+		return ;
+	head = atomic_load(&c->head);
+	if (head - atomic_load(&c->tail) >= CAPTURE_SLOTS)
+	{
+		c->dropped++;
+		return ;
+	}
+	dst = c->ring + (head % CAPTURE_SLOTS) * c->w * c->h;
+	y = 0;
+	while (y < c->h)
+	{
+		ft_memcpy(dst + y * c->w, cub->img->addr + y * cub->img->len,
+			c->w * 4);
+		y++;
+	}
+	c->seq[head % CAPTURE_SLOTS] = head + c->dropped;
+	atomic_store(&c->head, head + 1);
+	sem_post(&c->ready);
+}
+
+/**
+ * @brief Termine la capture et libère sa structure.
+ *
+ * Le thread d'écriture finit d'écrire les tampons en attente avant de
+ * s'arrêter. Le nombre de frames écrites, perdues et en échec est affiché.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	capture_close(t_Cub3d *cub)
+{
+	t_Capture	*c;
+
+	c = cub->capture;
+	if (!c)
+		return ;
+	if (c->started)
+	{
+		sem_post(&c->ready);
+		pthread_join(c->thread, NULL);
+		sem_destroy(&c->ready);
+		printf("capture: %lld frames, %lld written, %lld dropped, "
+			"%lld failed\n", c->head + c->dropped, c->head - c->failed,
+			c->dropped, c->failed);
+	}
+	if (c->fd >= 0)
+		close(c->fd);
+	free(c->ring);
+	free(c->out);
+	free(c);
+	cub->capture = NULL;
+}
@@ -0,0 +1,54 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Dessine une colonne de mur non ombrée à partir de sa table de
+ * lignes de texture.
+ *
+ * Noyau des faces nord et des portes, que 'apply_shader' laisse telles
+ * quelles: chaque pixel est une lecture de la table, une lecture du texel et
+ * une écriture.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_gather_flat(t_Column *k)
+{
+	unsigned int	*dst;
+	int				i;
+
+	dst = k->dst;
+	i = 0;
+	while (i < k->count)
+	{
+		*dst = k->src[k->rows[i] * k->tex_pitch];
+		dst += k->pitch;
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine une colonne de mur ombrée à partir de sa table de lignes
+ * de texture.
+ *
+ * Chaque composante du texel est multipliée par le facteur de la face, comme
+ * dans 'apply_shader', sans repasser par l'identifiant de la face.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_gather_shade(t_Column *k)
+{
+	unsigned int	*dst;
+	unsigned int	t;
+	int				i;
+
+	dst = k->dst;
+	i = 0;
+	while (i < k->count)
+	{
+		t = k->src[k->rows[i] * k->tex_pitch];
+		*dst = (int)(((t >> 16) & 0xFF) * k->shade) << 16
+			| (int)(((t >> 8) & 0xFF) * k->shade) << 8
+			| (int)((t & 0xFF) * k->shade);
+		dst += k->pitch;
+		i++;
+	}
+}
@@ -0,0 +1,76 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Dessine une colonne de mur indexée à partir de sa table de lignes
+ * de texture.
+ *
+ * Noyau de '--indexed': chaque texel est un octet, l'index de sa couleur,
+ * et la ligne de la table d'ombrage de la face donne directement la couleur
+ * ombrée. Le même noyau sert aux faces ombrées ou non.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_index_gather(t_Column *k)
+{
+	unsigned int	*dst;
+	int				i;
+
+	dst = k->dst;
+	i = 0;
+	while (i < k->count)
+	{
+		*dst = k->cmap[k->isrc[k->rows[i] * k->tex_pitch]];
+		dst += k->pitch;
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine une colonne de mur indexée pas à pas, pour une texture
+ * dont la demi-hauteur est une puissance de deux.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_index_pow2(t_Column *k)
+{
+	unsigned int	*dst;
+	float			pos;
+	int				mask;
+	int				i;
+
+	dst = k->dst;
+	pos = k->pos;
+	mask = k->wrap - 1;
+	i = 0;
+	while (i < k->count)
+	{
+		*dst = k->cmap[k->isrc[((int)pos & mask) * k->tex_pitch]];
+		pos += k->step;
+		dst += k->pitch;
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine une colonne de mur indexée pas à pas, pour une texture de
+ * hauteur quelconque.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_index_any(t_Column *k)
+{
+	unsigned int	*dst;
+	float			pos;
+	int				i;
+
+	dst = k->dst;
+	pos = k->pos;
+	i = 0;
+	while (i < k->count)
+	{
+		*dst = k->cmap[k->isrc[((int)pos % k->wrap) * k->tex_pitch]];
+		pos += k->step;
+		dst += k->pitch;
+		i++;
+	}
+}
@@ -0,0 +1,115 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Dessine une colonne de mur non ombrée pas à pas, pour une texture
+ * dont la demi-hauteur est une puissance de deux.
+ *
+ * Noyau des murs plus hauts que la vue, qui n'ont pas de table: la position
+ * dans la texture avance d'un pas par pixel et reboucle par un masque.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_step_pow2_flat(t_Column *k)
+{
+	unsigned int	*dst;
+	float			pos;
+	int				mask;
+	int				i;
+
+	dst = k->dst;
+	pos = k->pos;
+	mask = k->wrap - 1;
+	i = 0;
+	while (i < k->count)
+	{
+		*dst = k->src[((int)pos & mask) * k->tex_pitch];
+		pos += k->step;
+		dst += k->pitch;
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine une colonne de mur ombrée pas à pas, pour une texture dont
+ * la demi-hauteur est une puissance de deux.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_step_pow2_shade(t_Column *k)
+{
+	unsigned int	*dst;
+	unsigned int	t;
+	float			pos;
+	int				mask;
+	int				i;
+
+	dst = k->dst;
+	pos = k->pos;
+	mask = k->wrap - 1;
+	i = 0;
+	while (i < k->count)
+	{
+		t = k->src[((int)pos & mask) * k->tex_pitch];
+		*dst = (int)(((t >> 16) & 0xFF) * k->shade) << 16
+			| (int)(((t >> 8) & 0xFF) * k->shade) << 8
+			| (int)((t & 0xFF) * k->shade);
+		pos += k->step;
+		dst += k->pitch;
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine une colonne de mur non ombrée pas à pas, pour une texture
+ * de hauteur quelconque.
+ *
+ * La position reboucle par un modulo, qui reste juste quand la demi-hauteur
+ * de la texture n'est pas une puissance de deux.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_step_any_flat(t_Column *k)
+{
+	unsigned int	*dst;
+	float			pos;
+	int				i;
+
+	dst = k->dst;
+	pos = k->pos;
+	i = 0;
+	while (i < k->count)
+	{
+		*dst = k->src[((int)pos % k->wrap) * k->tex_pitch];
+		pos += k->step;
+		dst += k->pitch;
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine une colonne de mur ombrée pas à pas, pour une texture de
+ * hauteur quelconque.
+ *
+ * @param k La colonne à dessiner.
+ */
+void	col_step_any_shade(t_Column *k)
+{
+	unsigned int	*dst;
+	unsigned int	t;
+	float			pos;
+	int				i;
+
+	dst = k->dst;
+	pos = k->pos;
+	i = 0;
+	while (i < k->count)
+	{
+		t = k->src[((int)pos % k->wrap) * k->tex_pitch];
+		*dst = (int)(((t >> 16) & 0xFF) * k->shade) << 16
+			| (int)(((t >> 8) & 0xFF) * k->shade) << 8
+			| (int)((t & 0xFF) * k->shade);
+		pos += k->step;
+		dst += k->pitch;
+		i++;
+	}
+}
@@ -0,0 +1,182 @@
+#include "../../headers/cub3d.h"
+
+/*
+** Police bitmap 5x7: une ligne de 5 bits par rangée, bit de poids fort à
+** gauche. L'ordre des glyphes est celui de la chaîne FONT_CHARSET.
+*/
+static const unsigned char	g_glyphs[FONT_GLYPHS][7] = {
+	{0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},
+	{0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},
+	{0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},
+	{0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},
+	{0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},
+	{0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},
+	{0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},
+	{0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},
+	{0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},
+	{0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},
+	{0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
+	{0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},
+	{0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},
+	{0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},
+	{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},
+	{0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},
+	{0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},
+	{0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},
+	{0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},
+	{0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},
+	{0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},
+	{0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},
+	{0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},
+	{0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},
+	{0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
+	{0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},
+	{0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},
+	{0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},
+	{0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},
+	{0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},
+	{0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},
+	{0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04},
+	{0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},
+	{0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},
+	{0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04},
+	{0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},
+	{0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00},
+	{0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},
+	{0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00},
+	{0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03},
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F}
+};
+
+/**
+ * @brief Renvoie l'index du glyphe associé à un caractère.
+ *
+ * Les minuscules sont affichées avec les glyphes des majuscules.
+ *
+ * @param c Le caractère à afficher.
+ * @return L'index du glyphe dans la police, ou -1 si le caractère n'a pas de
+ * glyphe (il est alors affiché comme un espace).
+ */
+static int	glyph_index(char c)
+{
+	char	*found;
+
+	if (c >= 'a' && c <= 'z')
+		c -= 'a' - 'A';
+	if (!c)
+		return (-1);
+	found = ft_strchr(FONT_CHARSET, c);
+	if (!found)
+		return (-1);
+	return (found - FONT_CHARSET);
+}
+
+/**
+ * @brief Décompresse chaque glyphe 5x7 en un masque d'octets agrandi.
+ *
+ * @param f La police, cache alloué.
+ */
+static void	font_bake(t_Font *f)
+{
+	int	g;
+	int	i;
+
+	g = 0;
+	while (g < FONT_GLYPHS)
+	{
+		i = 0;
+		while (i < f->w * f->h)
+		{
+			f->cache[g * f->w * f->h + i] = (g_glyphs[g][i / f->w / FONT_SCALE]
+					>> (4 - i % f->w / FONT_SCALE)) & 1;
+			i++;
+		}
+		g++;
+	}
+}
+
+/**
+ * @brief Construit le cache des glyphes agrandis de la police.
+ *
+ * La fonction 'font_init' décompresse une seule fois chaque glyphe 5x7 en un
+ * masque d'octets agrandi FONT_SCALE fois. Le dessin du texte n'a ensuite
+ * qu'à recopier ces masques, sans décoder de bits ni passer par le serveur X
+ * comme le ferait 'mlx_string_put'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 si une allocation échoue.
+ */
+int	font_init(t_Cub3d *cub)
+{
+	t_Font	*f;
+
+	f = ft_calloc(1, sizeof(t_Font));
+	if (!f)
+		return (1);
+	cub->font = f;
+	f->w = 5 * FONT_SCALE;
+	f->h = 7 * FONT_SCALE;
+	f->cache = ft_calloc(FONT_GLYPHS * f->w * f->h, 1);
+	if (!f->cache)
+		return (1);
+	font_bake(f);
+	return (0);
+}
+
+/**
+ * @brief Dessine un glyphe du cache dans une image.
+ *
+ * @param img L'image de destination.
+ * @param f La police dont le cache contient le glyphe.
+ * @param pos La position (x, y) du coin supérieur gauche du glyphe.
+ * @param g L'index du glyphe, ou -1 pour un espace.
+ */
+static void	draw_glyph(t_ImageControl *img, t_Font *f, int pos[2], int g)
+{
+	unsigned char	*mask;
+	int				x;
+	int				y;
+
+	if (g < 0)
+		return ;
+	mask = f->cache + g * f->w * f->h;
+	y = 0;
+	while (y < f->h)
+	{
+		x = 0;
+		while (x < f->w)
+		{
+			if (mask[y * f->w + x] && pos[0] + x >= 0 && pos[0] + x < img->width
+				&& pos[1] + y >= 0 && pos[1] + y < img->height)
+				my_mlx_pixel_put(img, pos[0] + x, pos[1] + y, WHITE);
+			x++;
+		}
+		y++;
+	}
+}
+
+/**
+ * @brief Dessine une chaîne de caractères dans l'image du jeu.
+ *
+ * La fonction 'draw_text' écrit la chaîne 's' en blanc dans l'image
+ * principale, à partir de la position (x, y), avec la police en cache.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param x La position horizontale du premier caractère.
+ * @param y La position verticale de la ligne de texte.
+ * @param s La chaîne à afficher.
+ */
+void	draw_text(t_Cub3d *cub, int x, int y, char *s)
+{
+	int	pos[2];
+
+	pos[0] = x;
+	pos[1] = y;
+	while (*s)
+	{
+		draw_glyph(cub->img, cub->font, pos, glyph_index(*s));
+		pos[0] += cub->font->w + FONT_SCALE;
+		s++;
+	}
+}
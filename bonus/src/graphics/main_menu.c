@@ -24,7 +24,8 @@ void	update_button(t_Cub3d *c, t_ImageControl *i, int p, char b)
 		else
 			setup_menu(c, c->main->start, "./sprites/Menu/start_00.xpm");
 		mlx_put_image_to_window(c->mlx_ptr, c->win_ptr, i->img_ptr,
-			(WINDOW_X / 2) - i->width / 2, ((WINDOW_Y - 100) / 2) - i->height);
+			(c->win->width / 2) - i->width / 2,
+			((c->win->height - 100) / 2) - i->height);
 	}
 	else if (b == 'q')
 	{
@@ -33,7 +34,8 @@ void	update_button(t_Cub3d *c, t_ImageControl *i, int p, char b)
 		else
 			setup_menu(c, c->main->quit, "./sprites/Menu/quit_00.xpm");
 		mlx_put_image_to_window(c->mlx_ptr, c->win_ptr, i->img_ptr,
-			(WINDOW_X / 2) - i->width / 2, ((WINDOW_Y + 450) / 2) - i->height);
+			(c->win->width / 2) - i->width / 2,
+			((c->win->height + 450) / 2) - i->height);
 	}
 }
 
@@ -42,6 +44,7 @@ void	update_button(t_Cub3d *c, t_ImageControl *i, int p, char b)
  *
  * La fonction button_mo vérifie si le pointeur de la souris est positionné sur l'image
  * d'un bouton. Il renvoie 1 si le pointeur de la souris est sur le bouton, et 0 sinon.
+ * La position utilisée est la dernière reçue par 'on_mouse_move'.
  *
  * @param cub Pointeur vers la structure t_Cub3d, représentant le contexte du jeu.
  * @param i pointe vers la structure de contrôle t_Image représentant l'image du bouton.
@@ -50,21 +53,20 @@ void	update_button(t_Cub3d *c, t_ImageControl *i, int p, char b)
  */
 int	button_mo(t_Cub3d *cub, t_ImageControl *i, char b)
 {
-	mlx_mouse_get_pos(cub->mlx_ptr, cub->win_ptr, &cub->mouse_x, &cub->mouse_y);
 	if (b == 's')
 	{
-		if ((cub->mouse_x >= (WINDOW_X / 2) - i->width / 2)
-			&& (cub->mouse_x <= (WINDOW_X / 2) + i->width / 2)
-			&& (cub->mouse_y >= ((WINDOW_Y - 100) / 2) - i->height)
-			&& (cub->mouse_y <= (WINDOW_Y - 100) / 2))
+		if ((cub->mouse_x >= (cub->win->width / 2) - i->width / 2)
+			&& (cub->mouse_x <= (cub->win->width / 2) + i->width / 2)
+			&& (cub->mouse_y >= ((cub->win->height - 100) / 2) - i->height)
+			&& (cub->mouse_y <= (cub->win->height - 100) / 2))
 			return (1);
 	}
 	else if (b == 'q')
 	{
-		if ((cub->mouse_x >= (WINDOW_X / 2) - i->width / 2)
-			&& (cub->mouse_x <= (WINDOW_X / 2) + i->width / 2)
-			&& (cub->mouse_y >= ((WINDOW_Y + 450) / 2) - i->height)
-			&& (cub->mouse_y <= (WINDOW_Y + 450) / 2))
+		if ((cub->mouse_x >= (cub->win->width / 2) - i->width / 2)
+			&& (cub->mouse_x <= (cub->win->width / 2) + i->width / 2)
+			&& (cub->mouse_y >= ((cub->win->height + 450) / 2) - i->height)
+			&& (cub->mouse_y <= (cub->win->height + 450) / 2))
 			return (1);
 	}
 	return (0);
@@ -114,10 +116,10 @@ int	start_menu(t_Cub3d *cub)
 	setup_menu(cub, m->quit, "./sprites/Menu/quit_00.xpm");
 	cub->menu_ok = true;
 	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr, m->start->img->img_ptr,
-		(WINDOW_X / 2) - m->start->img->width / 2,
-		((WINDOW_Y - 100) / 2) - m->start->img->height);
+		(cub->win->width / 2) - m->start->img->width / 2,
+		((cub->win->height - 100) / 2) - m->start->img->height);
 	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr, m->quit->img->img_ptr,
-		(WINDOW_X / 2) - m->quit->img->width / 2,
-		((WINDOW_Y + 450) / 2) - m->quit->img->height);
+		(cub->win->width / 2) - m->quit->img->width / 2,
+		((cub->win->height + 450) / 2) - m->quit->img->height);
 	return (0);
 }
\ No newline at end of file
@@ -42,7 +42,8 @@ static int	get_color(int color[256][256][256])
  *
  * Cette fonction définit la couleur d'un pixel aux coordonnées spécifiées (x, y)
  * dans une image. Il faut une structure de contrôle d'image ('img'), la position
- * (x, y) du pixel et la valeur de couleur à définir.
+ * (x, y) du pixel et la valeur de couleur à définir. Chaque écriture est
+ * comptée dans 'img->writes' pour les statistiques du rendu.
  *
  * @param img Un pointeur vers la structure de contrôle de l'image représentant l'image.
  * @param x La coordonnée x du pixel.
@@ -55,6 +56,7 @@ void	my_mlx_pixel_put(t_ImageControl *img, int x, int y, int color)
 
 	dst = img->addr + (y * img->len + x * (img->bpp / 8));
 	*(unsigned int *)dst = color;
+	img->writes++;
 }
 
 /**
@@ -62,8 +64,9 @@ void	my_mlx_pixel_put(t_ImageControl *img, int x, int y, int color)
  *
  * Cette fonction affiche le plafond et le sol de la fenêtre de jeu en définissant
  * les couleurs des pixels dans le tampon d'image ('cub->img') pour toute la zone
- * de la fenêtre. Il utilise les couleurs définies dans la structure ('cub->map')
- * pour le plafond et le sol.
+ * de la vue 3D, à sa résolution. Il utilise les couleurs définies dans la structure ('cub->map')
+ * pour le plafond et le sol. L'image n'est affichée qu'une fois la frame
+ * terminée, par 'render_frame'.
  *
  * @param cub Un pointeur vers la structure Cub3d.
  */
@@ -77,19 +80,15 @@ void	render_ceilling_floor(t_Cub3d *cub)
 	x = 0;
 	cc = get_color(cub->map->ceilling_c);
 	fc = get_color(cub->map->floor_c);
-	while (x++ < WINDOW_X)
+	while (x < cub->win->render_w)
 	{
 		y = 0;
-		while (y++ <= WINDOW_Y / 2)
-			my_mlx_pixel_put(cub->img, x, y, cc);
-		while (y < WINDOW_Y)
-		{
-			my_mlx_pixel_put(cub->img, x, y, fc);
-			y++;
-		}
+		while (y <= cub->win->render_h / 2)
+			view_pixel_put(cub, x, y++, cc);
+		while (y < cub->win->render_h)
+			view_pixel_put(cub, x, y++, fc);
+		x++;
 	}
-	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
-		cub->img->img_ptr, 0, 0);
 }
 
 /**
@@ -102,15 +101,23 @@ void	render_ceilling_floor(t_Cub3d *cub)
  *
  * Plus précisément, cette fonction gère les tâches suivantes:
  *
+ * - Prépare la taille de la fenêtre ('--size') et la résolution de la vue 3D.
  * - Initialise la configuration de la caméra, essentielle pour le rayon.
  * - Valide et charge toutes les textures et ressources requises.
- * - Crée la fenêtre de jeu en utilisant la bibliothèque MLX avec une taille spécifiée.
+ * - Crée la fenêtre de jeu en utilisant la bibliothèque MLX avec la taille
+ * choisie ('window_create').
+ * En mode banc d'essai ('--bench') ou en relecture sans serveur X
+ * ('--headless'), MiniLibX est initialisée avec son backend
+ * nul: aucun serveur X, les images sont des tampons en mémoire et la fenêtre
+ * ne fait que compter les images qui lui sont envoyées.
  * - Prépare le tampon d'image du jeu pour le rendu.
  * - Initialise le menu Démarrer, permettant aux joueurs de commencer ou de quitter le jeu.
  * - Configure la minimap, qui donne un aperçu de la carte du jeu.
  * - Positionne et rend l'arme du joueur dans la vue du jeu.
  * - Place le personnage du joueur à la position de départ.
  * - Convertit les textures chargées en formats adaptés au rendu.
+ * - Regroupe les textures des murs, des portes et des matériaux dans un
+ * atlas.
  *
  * Si l'une de ces étapes d'initialisation échoue, la fonction renvoie un code d'erreur (1)
  * pour indiquer qu'il y a eu un problème avec le processus d'installation. Une valeur de
@@ -122,16 +129,16 @@ void	render_ceilling_floor(t_Cub3d *cub)
  */
 int	graphics(t_Cub3d *cub)
 {
-	if (camera_init(cub))
+	if (window_init(cub) || camera_init(cub))
 		return (1);
-	if (check_tex_validity(cub))
+	if (check_tex_validity(cub) || check_materials(cub))
+		return (1);
+	if (cub->opt->bench || cub->opt->headless)
+		cub->mlx_ptr = mlx_init_backend(MLX_BACKEND_NULL);
+	else
+		cub->mlx_ptr = mlx_init();
+	if (window_create(cub))
 		return (1);
-	cub->mlx_ptr = mlx_init();
-	cub->img = ft_calloc(1, sizeof(t_ImageControl));
-	cub->win_ptr = mlx_new_window(cub->mlx_ptr, WINDOW_X, WINDOW_Y, "CUB3D");
-	cub->img->img_ptr = mlx_new_image(cub->mlx_ptr, WINDOW_X, WINDOW_Y);
-	cub->img->addr = mlx_get_data_addr(cub->img->img_ptr,
-			&cub->img->bpp, &cub->img->len, &cub->img->endian);
 	if (start_menu(cub))
 		return (1);
 	init_minimap(cub);
@@ -141,5 +148,5 @@ int	graphics(t_Cub3d *cub)
 	if (convert_textures(cub))
 		return (1);
 	cub->files_ok = true;
-	return (0);
+	return (atlas_build(cub));
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
  * La fonction 'load_xpm' charge un fichier image XPM et le stocke en tant que texture
  * dans la structure 't_ImageControl'. Il définit les propriétés 'width' et 'height'
  * de l'image et la propriété 'img_ptr' sur le pointeur d'image chargé.
+ * Avec '--trace', chaque chargement apparaît dans la chronologie.
  *
  * @param c Pointeur vers la structure 't_Cub3d'.
  * @param i pointe vers la structure 't_ImageControl' représentant l'image à charger.
@@ -15,7 +16,9 @@ void	load_xpm(t_Cub3d *c, t_ImageControl *i, char *file)
 {
 	i->height = 0;
 	i->width = 0;
+	trace_event(c->trace, "load_xpm", 'B', file);
 	i->img_ptr = mlx_xpm_file_to_image(c->mlx_ptr, file, &i->width, &i->height);
+	trace_event(c->trace, "load_xpm", 'E', NULL);
 	if (!i->img_ptr)
 	{
 		free_main(c);
@@ -73,7 +76,8 @@ int	check_access(t_Cub3d *cub)
  * dans la structure 't_CameraConfig'. Il charge les fichiers image XPM pour les murs nord,
  * sud,ouest et est, les convertit en tableaux entiers et les stocke dans le tableau de 'tex'.
  * De plus, il alloue de la mémoire pour chaque texture et garantit le chargement réussi des
- * fichiers de texture.
+ * fichiers de texture. Les textures des matériaux déclarés sont chargées
+ * ensuite.
  *
  * @param cub Pointeur vers la structure 't_Cub3d'.
  * @return 0 en cas de succès, 1 s'il y a eu une erreur lors du chargement de la texture.
@@ -99,6 +103,7 @@ int	convert_textures(t_Cub3d *cub)
 		load_xpm(cub, cub->map->tex_door->img, cub->map->tex_door->path);
 		c->tex[4] = get_texture_addr(cub->map->tex_door->img);
 	}
+	load_materials(cub);
 	c->tex_vector = true;
 	return (0);
 }
@@ -117,12 +117,12 @@ double	get_wall_x(t_Cub3d *cub, t_CameraConfig *c)
 
 	if (!c->side)
 	{
-		wall_x = cub->player->pos_y + c->perp_wd * c->raydir_y;
+		wall_x = cub->sim->view.pos_y + c->perp_wd * c->raydir_y;
 		wall_x -= c->map_y;
 	}
 	else
 	{
-		wall_x = cub->player->pos_x + c->perp_wd * c->raydir_x;
+		wall_x = cub->sim->view.pos_x + c->perp_wd * c->raydir_x;
 		wall_x -= c->map_x;
 	}
 	return (wall_x);
@@ -135,28 +135,33 @@ double	get_wall_x(t_Cub3d *cub, t_CameraConfig *c)
  * 'x' tout en tenant compte de l'effet de shader. Il calcule les coordonnées de texture,
  * y compris "tx" et "ty", en fonction de la position et de l'orientation du mur. La fonction
  * parcourt ensuite la hauteur du mur et applique la texture à chaque pixel du mur, en tenant
- * compte du décalage de texture et de l'effet de shader.
+ * compte du décalage de texture et de l'effet de shader. Avec des pixels de
+ * 32 bits, la colonne est dessinée par un noyau spécialisé de
+ * 'texture_column'; le calcul par pixel ne sert plus que pour les autres
+ * formats.
  *
  * @param Pointeur cur vers la structure 't_Cub3d'.
  * @param c Pointeur vers la structure 't_CameraConfig' contenant les données
  * de configuration de la caméra.
  * @param x La colonne d'écran en cours de traitement.
- * @param id Un identifiant spécifiant la texture à appliquer (nord, sud, ouest, est).
+ * @param id L'entrée de l'atlas de la texture à appliquer ('wall_tex'):
+ * face du mur, porte ou matériau.
  */
 void	apply_texture(t_Cub3d *cub, t_CameraConfig *c, int x, int id)
 {
-	double			wall_x;
 	double			tx;
 	double			ty;
 	int				y;
 	t_ImageControl	*img;
 
-	img = get_img_struct(cub, id);
-	wall_x = get_wall_x(cub, c);
-	tx = (int)(wall_x * (double)img->width);
+	img = &cub->atlas->tex[id];
+	tx = (int)(get_wall_x(cub, c) * (double)img->width);
 	tx = img->width - tx - 1;
+	c->tex_x = tx;
+	if (tx < 0 || texture_column(cub, c, img, x))
+		return ;
 	c->tex_step = 1.0 * img->width / c->line_height;
-	c->tex_pos = (c->draw_start - WINDOW_Y / 2 + c->line_height) * c->tex_step;
+	c->tex_pos = (c->draw_start - c->height / 2 + c->line_height) * c->tex_step;
 	y = c->draw_start;
 	while (y++ < c->draw_end)
 	{
@@ -164,9 +169,9 @@ void	apply_texture(t_Cub3d *cub, t_CameraConfig *c, int x, int id)
 		c->tex_pos += c->tex_step;
 		if (x >= 0 && y >= 0 && tx >= 0 && ty >= 0)
 		{
-			c->color = my_mlx_pixel_get(img, tx, ty);
-			c->color = apply_shader(c->color, c->wall_dir);
-			my_mlx_pixel_put(cub->img, x, y, c->color);
+			c->color = apply_shader(my_mlx_pixel_get(img, tx, ty), c->wall_dir);
+			view_pixel_put(cub, x, y, c->color);
+			cub->atlas->reads++;
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Rassemble les texels des textures indexées pour le découpage.
+ *
+ * Chaque texel donne un élément: sa couleur, lue dans l'image de
+ * MiniLibX, et sa position dans l'atlas, où son index sera écrit.
+ *
+ * @param a Pointeur vers l'atlas.
+ * @param p Pointeur vers le découpage, 'e' alloué.
+ */
+static void	pal_collect(t_Atlas *a, t_PalCut *p)
+{
+	t_ImageControl	*img;
+	unsigned int	color;
+	int				s;
+	int				i;
+
+	p->count[0] = 0;
+	s = -1;
+	while (++s < ATLAS_SLOTS)
+	{
+		img = &a->tex[s];
+		i = -1;
+		while (a->index[s] && ++i < img->width * img->height)
+		{
+			color = *(unsigned int *)(img->addr + i / img->width * img->len
+					+ i % img->width * 4);
+			p->e[p->count[0]++] = (unsigned long long)(color & 0xFFFFFF) << 32
+				| (unsigned int)((char *)a->index[s] + i - a->base);
+		}
+	}
+}
+
+/**
+ * @brief Donne sa couleur à chaque boîte et écrit les index de l'atlas.
+ *
+ * La couleur d'une boîte est la moyenne de ses texels; elle est exacte
+ * quand la boîte n'a qu'une couleur.
+ *
+ * @param a Pointeur vers l'atlas, palette allouée.
+ * @param p Pointeur vers le découpage terminé.
+ */
+static void	pal_assign(t_Atlas *a, t_PalCut *p)
+{
+	long long	sum[3];
+	int			b;
+	int			i;
+
+	b = -1;
+	while (++b < p->boxes)
+	{
+		ft_bzero(sum, sizeof(sum));
+		i = p->start[b] - 1;
+		while (++i < p->start[b] + p->count[b])
+		{
+			sum[0] += (p->e[i] >> 48) & 0xFF;
+			sum[1] += (p->e[i] >> 40) & 0xFF;
+			sum[2] += (p->e[i] >> 32) & 0xFF;
+			a->base[p->e[i] & 0xFFFFFFFF] = b;
+		}
+		if (p->count[b])
+			a->pal->color[b] = (sum[0] / p->count[b]) << 16
+				| (sum[1] / p->count[b]) << 8 | sum[2] / p->count[b];
+	}
+	a->pal->count = p->boxes;
+}
+
+/**
+ * @brief Remplit les tables d'ombrage de la palette.
+ *
+ * Comme la COLORMAP de Doom: chaque ligne applique une fois pour toutes
+ * 'apply_shader' d'une face (nord et portes, sud, ouest, est) à toutes les
+ * couleurs de la palette.
+ *
+ * @param pal Pointeur vers la palette, couleurs remplies.
+ */
+static void	pal_colormap(t_Palette *pal)
+{
+	int	row;
+	int	i;
+
+	row = -1;
+	while (++row < CMAP_ROWS)
+	{
+		i = -1;
+		while (++i < PAL_SIZE)
+			pal->cmap[row][i] = apply_shader(pal->color[i], row + 1);
+	}
+}
+
+/**
+ * @brief Construit la palette des textures indexées et ses tables
+ * d'ombrage.
+ *
+ * Les texels des textures de 32 bits sont répartis sur PAL_SIZE couleurs
+ * au plus par découpage médian ('palette_cut'), puis l'index de chaque
+ * texel est écrit dans l'atlas. Les tampons du découpage sont libérés
+ * aussitôt.
+ *
+ * @param cub Pointeur vers la structure principale du jeu, atlas rempli.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation.
+ */
+int	palette_build(t_Cub3d *cub)
+{
+	t_Atlas		*a;
+	t_PalCut	*p;
+
+	a = cub->atlas;
+	a->pal = ft_calloc(1, sizeof(t_Palette));
+	p = ft_calloc(1, sizeof(t_PalCut));
+	if (!a->pal || !p)
+		return (free(p), 1);
+	p->e = malloc(a->bytes * 2 * sizeof(unsigned long long) + 1);
+	if (!p->e)
+		return (free(p), 1);
+	p->tmp = p->e + a->bytes;
+	pal_collect(a, p);
+	palette_cut(p);
+	pal_assign(a, p);
+	free(p->e);
+	free(p);
+	pal_colormap(a->pal);
+	return (0);
+}
+
+/**
+ * @brief Affiche la taille de l'atlas des textures à la fin du banc
+ * d'essai, et sa palette avec '--indexed'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	atlas_report(t_Cub3d *cub)
+{
+	if (!cub->atlas)
+		return ;
+	printf("bench: atlas %.1f KB", cub->atlas->bytes / 1024.0);
+	if (cub->atlas->pal)
+		printf(", %d-colour palette, %d shade tables",
+			cub->atlas->pal->count, CMAP_ROWS);
+	printf("\n");
+}
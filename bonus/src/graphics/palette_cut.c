@@ -0,0 +1,147 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie une composante de la couleur d'un élément du découpage.
+ *
+ * @param e L'élément: couleur du texel et position dans l'atlas.
+ * @param ch La composante: 0 rouge, 1 vert, 2 bleu.
+ * @return La valeur de la composante, de 0 à 255.
+ */
+static int	cut_chan(unsigned long long e, int ch)
+{
+	return ((int)(e >> (48 - 8 * ch)) & 0xFF);
+}
+
+/**
+ * @brief Mesure l'étendue d'une boîte et choisit sa composante à couper.
+ *
+ * @param p Pointeur vers le découpage.
+ * @param b La boîte à mesurer.
+ */
+static void	cut_measure(t_PalCut *p, int b)
+{
+	int	lo[3];
+	int	hi[3];
+	int	ch;
+	int	i;
+
+	ch = -1;
+	while (++ch < 3)
+	{
+		lo[ch] = 255;
+		hi[ch] = 0;
+		i = p->start[b] - 1;
+		while (++i < p->start[b] + p->count[b])
+		{
+			lo[ch] = fmin(lo[ch], cut_chan(p->e[i], ch));
+			hi[ch] = fmax(hi[ch], cut_chan(p->e[i], ch));
+		}
+	}
+	p->chan[b] = 0;
+	if (hi[1] - lo[1] > hi[p->chan[b]] - lo[p->chan[b]])
+		p->chan[b] = 1;
+	if (hi[2] - lo[2] > hi[p->chan[b]] - lo[p->chan[b]])
+		p->chan[b] = 2;
+	p->range[b] = hi[p->chan[b]] - lo[p->chan[b]];
+}
+
+/**
+ * @brief Trie une boîte sur sa composante la plus étendue.
+ *
+ * Tri par dénombrement: 256 valeurs possibles, un passage pour compter, un
+ * pour ranger dans 'tmp' et une recopie.
+ *
+ * @param p Pointeur vers le découpage.
+ * @param b La boîte à trier.
+ */
+static void	cut_sort(t_PalCut *p, int b)
+{
+	int	pos[257];
+	int	end;
+	int	i;
+
+	ft_bzero(pos, sizeof(pos));
+	end = p->start[b] + p->count[b];
+	i = p->start[b] - 1;
+	while (++i < end)
+		pos[cut_chan(p->e[i], p->chan[b]) + 1]++;
+	i = 0;
+	while (++i < 257)
+		pos[i] += pos[i - 1];
+	i = p->start[b] - 1;
+	while (++i < end)
+		p->tmp[p->start[b] + pos[cut_chan(p->e[i], p->chan[b])]++] = p->e[i];
+	ft_memcpy(p->e + p->start[b], p->tmp + p->start[b],
+		p->count[b] * sizeof(unsigned long long));
+}
+
+/**
+ * @brief Choisit où couper une boîte triée.
+ *
+ * La coupe est au milieu de la boîte, déplacée au changement de valeur le
+ * plus proche: une même couleur ne tombe jamais des deux côtés. Avec 256
+ * couleurs distinctes ou moins, chaque boîte finit donc par n'en garder
+ * qu'une, et la palette est exacte.
+ *
+ * @param p Pointeur vers le découpage.
+ * @param b La boîte, triée sur sa composante la plus étendue.
+ * @return Le nombre d'éléments qui restent dans la boîte.
+ */
+static int	cut_median(t_PalCut *p, int b)
+{
+	unsigned long long	*e;
+	int					v;
+	int					m;
+
+	e = p->e + p->start[b];
+	m = p->count[b] / 2;
+	v = cut_chan(e[m], p->chan[b]);
+	while (m > 0 && cut_chan(e[m - 1], p->chan[b]) == v)
+		m--;
+	if (m > 0)
+		return (m);
+	while (cut_chan(e[m], p->chan[b]) == v)
+		m++;
+	return (m);
+}
+
+/**
+ * @brief Répartit les texels en au plus PAL_SIZE boîtes par découpage
+ * médian.
+ *
+ * Tant qu'il reste de la place dans la palette, la boîte la plus étendue
+ * est coupée en deux sur sa composante la plus étendue. Le découpage
+ * s'arrête plus tôt quand chaque boîte n'a plus qu'une couleur.
+ *
+ * @param p Pointeur vers le découpage, 'count[0]' fixé au nombre de
+ * texels.
+ * @return Le nombre de boîtes, c'est-à-dire de couleurs de la palette.
+ */
+int	palette_cut(t_PalCut *p)
+{
+	int	b;
+	int	m;
+	int	i;
+
+	p->boxes = 1;
+	p->start[0] = 0;
+	cut_measure(p, 0);
+	while (p->boxes < PAL_SIZE)
+	{
+		b = 0;
+		i = 0;
+		while (++i < p->boxes)
+			if (p->range[i] > p->range[b])
+				b = i;
+		if (p->range[b] <= 0)
+			break ;
+		cut_sort(p, b);
+		m = cut_median(p, b);
+		p->start[p->boxes] = p->start[b] + m;
+		p->count[p->boxes] = p->count[b] - m;
+		p->count[b] = m;
+		cut_measure(p, b);
+		cut_measure(p, p->boxes++);
+	}
+	return (p->boxes);
+}
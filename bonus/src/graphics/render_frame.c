@@ -0,0 +1,81 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Dessine le monde du jeu: minimap et vue 3D.
+ *
+ * La vue 3D est rendue à la résolution de 'cub->win', puis agrandie à la
+ * taille de la fenêtre si cette résolution est réduite.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+static void	render_world(t_Cub3d *cub)
+{
+	prof_begin(cub->prof, PROF_IMAGE);
+	cub3d_new_image(cub);
+	minimap_new_image(cub);
+	prof_end(cub->prof, PROF_IMAGE);
+	prof_begin(cub->prof, PROF_MINIMAP);
+	draw_minimap(cub);
+	prof_end(cub->prof, PROF_MINIMAP);
+	draw_rays(cub);
+	prof_begin(cub->prof, PROF_UPSCALE);
+	window_upscale(cub);
+	prof_end(cub->prof, PROF_UPSCALE);
+}
+
+/**
+ * @brief Dessine l'interface par-dessus la vue: pistolet, réticule et
+ * overlay du profileur.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+static void	render_hud(t_Cub3d *cub)
+{
+	prof_begin(cub->prof, PROF_HUD);
+	draw_gun(cub, cub->player, 0, 0);
+	draw_crosshair(cub, cub->player, 0, 0);
+	prof_draw_overlay(cub);
+	prof_end(cub->prof, PROF_HUD);
+}
+
+/**
+ * @brief Affiche l'image du jeu et la minimap dans la fenêtre.
+ *
+ * Avec '--capture', l'image du jeu est aussi copiée dans l'anneau de la
+ * capture; cette copie est comptée dans l'étape de présentation.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+static void	present_frame(t_Cub3d *cub)
+{
+	prof_begin(cub->prof, PROF_PRESENT);
+	trace_event(cub->trace, "mlx_put_image", 'B', NULL);
+	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
+		cub->img->img_ptr, 0, 0);
+	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
+		cub->minimap->img->img_ptr, MINIMAP_POS, MINIMAP_POS);
+	trace_event(cub->trace, "mlx_put_image", 'E', NULL);
+	capture_frame(cub);
+	prof_end(cub->prof, PROF_PRESENT);
+}
+
+/**
+ * @brief Rend et affiche une frame complète du jeu.
+ *
+ * La fonction 'render_frame' applique d'abord une nouvelle taille de
+ * fenêtre ou de vue 3D ('window_update'), puis crée les nouvelles images,
+ * dessine la minimap, la vue 3D et l'interface, et les place dans la
+ * fenêtre. Chaque étape est mesurée par le profileur, qui reçoit aussi le
+ * nombre de pixels écrits dans l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	render_frame(t_Cub3d *cub)
+{
+	window_update(cub);
+	render_world(cub);
+	render_hud(cub);
+	present_frame(cub);
+	cub->prof->rs.writes = cub->img->writes;
+	cub->img->writes = 0;
+}
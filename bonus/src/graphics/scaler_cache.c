@@ -0,0 +1,116 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Alloue le cache vide des tables de lignes de texture.
+ *
+ * Les tables elles-mêmes sont construites à la demande, à la première
+ * colonne de mur de chaque hauteur.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation.
+ */
+int	scaler_init(t_Cub3d *cub)
+{
+	cub->scaler = ft_calloc(1, sizeof(t_ScalerCache));
+	if (!cub->scaler)
+		return (1);
+	ft_memset(cub->scaler->bucket, -1, sizeof(cub->scaler->bucket));
+	return (0);
+}
+
+/**
+ * @brief Libère le cache des tables de lignes de texture.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	scaler_free(t_Cub3d *cub)
+{
+	int	i;
+
+	if (!cub->scaler)
+		return ;
+	i = 0;
+	while (i < cub->scaler->count)
+		free(cub->scaler->slots[i++].rows);
+	free(cub->scaler);
+	cub->scaler = NULL;
+}
+
+/**
+ * @brief Libère l'emplacement de la table utilisée le moins récemment.
+ *
+ * La table est retirée de la chaîne de son seau; sa mémoire reste à
+ * l'emplacement, pour la table qui la remplace. La recherche parcourt tous
+ * les emplacements, mais seulement quand une table est construite dans un
+ * cache plein.
+ *
+ * @param sc Pointeur vers le cache des tables, plein.
+ * @return L'index de l'emplacement libéré.
+ */
+int	scaler_evict(t_ScalerCache *sc)
+{
+	int	*link;
+	int	lru;
+	int	i;
+
+	lru = 0;
+	i = 1;
+	while (i < SCALER_SLOTS)
+	{
+		if (sc->slots[i].used < sc->slots[lru].used)
+			lru = i;
+		i++;
+	}
+	link = &sc->bucket[sc->slots[lru].hash];
+	while (*link != lru)
+		link = &sc->slots[*link].next;
+	*link = sc->slots[lru].next;
+	sc->evictions++;
+	return (lru);
+}
+
+/**
+ * @brief Ajoute aux compteurs du rendu ceux du cache de la frame.
+ *
+ * Les colonnes servies et les tables construites depuis la frame précédente
+ * sont ajoutées, puis remises à zéro dans le cache; la mémoire des tables
+ * est celle du moment.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param s Les compteurs du rendu de la frame.
+ */
+void	scaler_stats(t_Cub3d *cub, t_RenderStats *s)
+{
+	if (!cub->scaler)
+		return ;
+	s->scaler_hits += cub->scaler->frame_hits;
+	s->scaler_misses += cub->scaler->frame_misses;
+	s->scaler_bytes = cub->scaler->bytes;
+	cub->scaler->frame_hits = 0;
+	cub->scaler->frame_misses = 0;
+}
+
+/**
+ * @brief Affiche le bilan du cache des tables de lignes de texture.
+ *
+ * Sont affichés le nombre de tables et leur mémoire, le taux de colonnes
+ * servies par une table existante, les tables construites et celles
+ * remplacées faute de place.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	scaler_report(t_Cub3d *cub)
+{
+	t_ScalerCache	*sc;
+	long long		total;
+
+	sc = cub->scaler;
+	if (!sc)
+		return ;
+	total = sc->hits + sc->misses;
+	if (!total)
+		total = 1;
+	printf("bench: scaler %d tables, %.1f KB, %.2f%% hits (%lld built, %lld "
+		"evicted)\n", sc->count, sc->bytes / 1024.0, 100.0 * sc->hits / total,
+		sc->misses, sc->evictions);
+}
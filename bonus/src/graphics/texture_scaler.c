@@ -0,0 +1,155 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Ramène une ligne de texture dans la moitié haute de la texture.
+ *
+ * Le masque de 'apply_texture' ne reboucle correctement que si cette moitié
+ * a une hauteur en puissance de deux: pour les autres hauteurs, la ligne
+ * est ramenée par un modulo. Les noyaux pas à pas font le même choix
+ * ('column_kernel').
+ *
+ * @param row La ligne tronquée, positive.
+ * @param wrap La hauteur de la moitié haute de la texture.
+ * @return La ligne lue dans la texture.
+ */
+int	texture_wrap(int row, int wrap)
+{
+	if (wrap & (wrap - 1))
+		return (row % wrap);
+	return (row & (wrap - 1));
+}
+
+/**
+ * @brief Remplit la table des lignes de texture d'une colonne de mur.
+ *
+ * Le calcul est exactement celui de 'apply_texture': le pas et la position
+ * dans la texture sont des 'float', la position est tronquée puis ramenée
+ * dans la moitié haute de la texture. La colonne dessinée avec la table est
+ * donc identique au pixel près, la position étant ramenée par
+ * 'texture_wrap'.
+ *
+ * @param s La table à remplir, dont 'len' est déjà fixé.
+ * @param c Pointeur vers la configuration de la caméra.
+ * @param img La texture du mur.
+ */
+static void	scaler_fill(t_Scaler *s, t_CameraConfig *c, t_ImageControl *img)
+{
+	float	step;
+	float	pos;
+	int		i;
+
+	step = 1.0 * img->width / c->line_height;
+	pos = (c->draw_start - c->height / 2 + c->line_height) * step;
+	i = 0;
+	while (i < s->len)
+	{
+		s->rows[i] = texture_wrap((int)pos, img->height / 2);
+		pos += step;
+		i++;
+	}
+}
+
+/**
+ * @brief Choisit l'emplacement d'une nouvelle table et le chaîne à son seau.
+ *
+ * Tant que le cache n'est pas plein, l'emplacement suivant est pris. Sinon,
+ * l'emplacement de la table utilisée le moins récemment est réutilisé, avec
+ * sa mémoire.
+ *
+ * @param sc Pointeur vers le cache des tables.
+ * @param h Le seau de la nouvelle table.
+ * @return L'emplacement, chaîné en tête du seau 'h'.
+ */
+static t_Scaler	*scaler_slot(t_ScalerCache *sc, int h)
+{
+	int	i;
+
+	if (sc->count < SCALER_SLOTS)
+		i = sc->count++;
+	else
+		i = scaler_evict(sc);
+	sc->slots[i].hash = h;
+	sc->slots[i].next = sc->bucket[h];
+	sc->bucket[h] = i;
+	return (&sc->slots[i]);
+}
+
+/**
+ * @brief Construit la table d'une colonne et l'ajoute au cache.
+ *
+ * La table est chaînée dans son seau avant son allocation: si l'allocation
+ * échoue, sa clé est invalidée et elle attend d'être remplacée, la colonne
+ * étant dessinée sans table.
+ *
+ * @param sc Pointeur vers le cache des tables.
+ * @param c Pointeur vers la configuration de la caméra.
+ * @param img La texture du mur.
+ * @param h Le seau de la clé.
+ * @return La table construite, ou NULL si l'allocation échoue.
+ */
+static t_Scaler	*scaler_add(t_ScalerCache *sc, t_CameraConfig *c,
+		t_ImageControl *img, int h)
+{
+	t_Scaler	*s;
+
+	s = scaler_slot(sc, h);
+	s->used = ++sc->clock;
+	s->lh = -1;
+	s->len = c->draw_end - c->draw_start;
+	if (s->len > s->cap)
+	{
+		free(s->rows);
+		sc->bytes -= s->cap * sizeof(unsigned short);
+		s->cap = 0;
+		s->rows = malloc(s->len * sizeof(unsigned short));
+		if (!s->rows)
+			return (NULL);
+		s->cap = s->len;
+		sc->bytes += s->cap * sizeof(unsigned short);
+	}
+	s->lh = c->line_height;
+	s->height = c->height;
+	s->tex_w = img->width;
+	s->tex_h = img->height;
+	scaler_fill(s, c, img);
+	sc->misses++;
+	sc->frame_misses++;
+	return (s);
+}
+
+/**
+ * @brief Renvoie la table d'une colonne de mur, construite si besoin.
+ *
+ * Seuls les murs qui tiennent dans la hauteur de la vue ont une table: les
+ * murs plus hauts, collés à la caméra, gardent le calcul pas à pas. Le
+ * noyau de 'texture_column' lit ensuite la table au lieu de calculer la
+ * position dans la texture.
+ *
+ * @param sc Pointeur vers le cache des tables, ou NULL.
+ * @param c Pointeur vers la configuration de la caméra.
+ * @param img La texture du mur.
+ * @return La table, ou NULL si la colonne n'en a pas.
+ */
+t_Scaler	*scaler_get(t_ScalerCache *sc, t_CameraConfig *c,
+		t_ImageControl *img)
+{
+	int	h;
+	int	i;
+
+	if (!sc || c->line_height <= 0 || c->line_height > c->height)
+		return (NULL);
+	h = (c->line_height * 31 + c->height * 7 + img->width * 3 + img->height)
+		& (SCALER_BUCKETS - 1);
+	i = sc->bucket[h];
+	while (i >= 0 && (sc->slots[i].lh != c->line_height
+			|| sc->slots[i].height != c->height
+			|| sc->slots[i].tex_w != img->width
+			|| sc->slots[i].tex_h != img->height))
+		i = sc->slots[i].next;
+	if (i < 0)
+		return (scaler_add(sc, c, img, h));
+	sc->hits++;
+	sc->frame_hits++;
+	sc->slots[i].used = ++sc->clock;
+	return (&sc->slots[i]);
+}
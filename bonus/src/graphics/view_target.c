@@ -0,0 +1,135 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Prépare le tampon de la vue 3D rangé par colonnes.
+ *
+ * Avec '--column-major', la vue 3D est rendue dans un tampon où chaque
+ * colonne de l'écran est contiguë: c'est une image transposée, dont les
+ * lignes sont les colonnes de la vue. Le tampon est réalloué quand la
+ * résolution de la vue change (fenêtre redimensionnée ou résolution
+ * dynamique). Si l'allocation échoue, la frame est rendue directement
+ * dans l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	view_update(t_Cub3d *cub)
+{
+	t_ImageControl	*v;
+
+	if (!cub->opt->column_major)
+		return ;
+	if (!cub->view)
+		cub->view = ft_calloc(1, sizeof(t_ImageControl));
+	v = cub->view;
+	if (!v || (v->addr && v->width == cub->win->render_h
+			&& v->height == cub->win->render_w))
+		return ;
+	free(v->addr);
+	v->width = cub->win->render_h;
+	v->height = cub->win->render_w;
+	v->bpp = 32;
+	v->len = v->width * 4;
+	v->addr = malloc((size_t)v->len * v->height);
+	if (!v->addr)
+		view_free(cub);
+}
+
+/**
+ * @brief Écrit un pixel de la vue 3D.
+ *
+ * Avec '--column-major', le pixel est écrit dans le tampon rangé par
+ * colonnes: les pixels successifs d'une colonne sont contigus en mémoire.
+ * Sinon, il est écrit directement dans l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param x La colonne du pixel.
+ * @param y La ligne du pixel.
+ * @param color La couleur du pixel.
+ */
+void	view_pixel_put(t_Cub3d *cub, int x, int y, int color)
+{
+	if (cub->view)
+		my_mlx_pixel_put(cub->view, y, x, color);
+	else
+		my_mlx_pixel_put(cub->img, x, y, color);
+}
+
+/**
+ * @brief Transpose un bloc de VIEW_BLOCK x VIEW_BLOCK pixels de la vue.
+ *
+ * Le bloc lu occupe VIEW_BLOCK lignes de cache du tampon par colonnes, et
+ * le bloc écrit VIEW_BLOCK lignes de cache de l'image du jeu: les deux
+ * restent dans le cache pendant toute la copie.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param x0 La première colonne du bloc.
+ * @param y0 La première ligne du bloc.
+ */
+static void	transpose_block(t_Cub3d *cub, int x0, int y0)
+{
+	unsigned int	*src;
+	char			*dst;
+	int				x;
+	int				y;
+
+	x = x0;
+	while (x < x0 + VIEW_BLOCK && x < cub->win->render_w)
+	{
+		src = (unsigned int *)(cub->view->addr + x * cub->view->len);
+		dst = cub->img->addr + x * 4;
+		y = y0;
+		while (y < y0 + VIEW_BLOCK && y < cub->win->render_h)
+		{
+			*(unsigned int *)(dst + y * cub->img->len) = src[y];
+			y++;
+		}
+		x++;
+	}
+}
+
+/**
+ * @brief Recopie la vue rendue par colonnes dans l'image du jeu.
+ *
+ * La transposition est faite par blocs de VIEW_BLOCK x VIEW_BLOCK pixels,
+ * avant la carte de chaleur et l'agrandissement de la vue. Les pixels
+ * écrits dans le tampon sont ajoutés à ceux de l'image pour les
+ * statistiques du rendu; les écritures de la transposition ne sont pas
+ * comptées.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	view_transpose(t_Cub3d *cub)
+{
+	int	x;
+	int	y;
+
+	if (!cub->view)
+		return ;
+	y = 0;
+	while (y < cub->win->render_h)
+	{
+		x = 0;
+		while (x < cub->win->render_w)
+		{
+			transpose_block(cub, x, y);
+			x += VIEW_BLOCK;
+		}
+		y += VIEW_BLOCK;
+	}
+	cub->img->writes += cub->view->writes;
+	cub->view->writes = 0;
+}
+
+/**
+ * @brief Libère le tampon de la vue rangé par colonnes.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	view_free(t_Cub3d *cub)
+{
+	if (!cub->view)
+		return ;
+	free(cub->view->addr);
+	free(cub->view);
+	cub->view = NULL;
+}
@@ -0,0 +1,120 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Prépare la taille de la fenêtre et la résolution de la vue 3D.
+ *
+ * La fenêtre prend la taille de l'option '--size', WINDOW_X * WINDOW_Y par
+ * défaut, et la vue 3D la résolution de l'option '--scale', pleine par
+ * défaut. Avec '--frame-budget', la résolution de la vue suit ensuite la
+ * durée des frames (voir 'window_update').
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation.
+ */
+int	window_init(t_Cub3d *cub)
+{
+	t_WindowConfig	*w;
+
+	w = ft_calloc(1, sizeof(t_WindowConfig));
+	cub->win = w;
+	if (!w)
+		return (1);
+	w->width = WINDOW_X;
+	w->height = WINDOW_Y;
+	if (cub->opt->width)
+	{
+		w->width = cub->opt->width;
+		w->height = cub->opt->height;
+	}
+	w->budget_ns = cub->opt->frame_budget * 1000000LL;
+	w->scale = 100;
+	if (cub->opt->scale)
+		w->scale = cub->opt->scale;
+	window_set_scale(w, w->scale);
+	return (0);
+}
+
+/**
+ * @brief Change la résolution de la vue 3D.
+ *
+ * La résolution est bornée entre SCALE_MIN et 100 % de la fenêtre, dans
+ * chaque dimension, ce qui garde les proportions de la fenêtre.
+ *
+ * @param w Pointeur vers la configuration de la fenêtre.
+ * @param scale La résolution voulue, en pourcentage de la fenêtre.
+ */
+void	window_set_scale(t_WindowConfig *w, int scale)
+{
+	if (scale < SCALE_MIN)
+		scale = SCALE_MIN;
+	if (scale > 100)
+		scale = 100;
+	w->scale = scale;
+	w->render_w = w->width * scale / 100;
+	w->render_h = w->height * scale / 100;
+	w->frames = 0;
+}
+
+/**
+ * @brief Crée la fenêtre du jeu et l'image dans laquelle la frame est rendue.
+ *
+ * En jeu, la fenêtre peut être redimensionnée jusqu'à WINDOW_MIN_X *
+ * WINDOW_MIN_Y; pendant une capture, sa taille reste celle des frames
+ * capturées.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+int	window_create(t_Cub3d *cub)
+{
+	cub->img = ft_calloc(1, sizeof(t_ImageControl));
+	if (!cub->mlx_ptr || !cub->img)
+		return (1);
+	cub->win_ptr = mlx_new_window(cub->mlx_ptr, cub->win->width,
+			cub->win->height, "CUB3D");
+	if (!cub->win_ptr)
+		return (1);
+	if (!cub->opt->capture)
+		mlx_window_resizable(cub->mlx_ptr, cub->win_ptr, WINDOW_MIN_X,
+			WINDOW_MIN_Y);
+	cub->img->img_ptr = mlx_new_image(cub->mlx_ptr, cub->win->width,
+			cub->win->height);
+	if (!cub->img->img_ptr)
+		return (1);
+	cub->img->addr = mlx_get_data_addr(cub->img->img_ptr,
+			&cub->img->bpp, &cub->img->len, &cub->img->endian);
+	cub->img->width = cub->win->width;
+	cub->img->height = cub->win->height;
+	cub->redraw = true;
+	return (0);
+}
+
+/**
+ * @brief Reçoit la nouvelle taille de la fenêtre (événement ConfigureNotify).
+ *
+ * La taille est bornée à WINDOW_MIN_X * WINDOW_MIN_Y et WINDOW_MAX_X *
+ * WINDOW_MAX_Y, puis appliquée au début de la frame suivante par
+ * 'window_update', jamais pendant un rendu.
+ *
+ * @param width La nouvelle largeur de la fenêtre.
+ * @param height La nouvelle hauteur de la fenêtre.
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return renvoie toujours 0.
+ */
+int	on_window_configure(int width, int height, t_Cub3d *cub)
+{
+	if (width < WINDOW_MIN_X)
+		width = WINDOW_MIN_X;
+	if (width > WINDOW_MAX_X)
+		width = WINDOW_MAX_X;
+	if (height < WINDOW_MIN_Y)
+		height = WINDOW_MIN_Y;
+	if (height > WINDOW_MAX_Y)
+		height = WINDOW_MAX_Y;
+	cub->win->resize_w = 0;
+	if (width == cub->win->width && height == cub->win->height)
+		return (0);
+	cub->win->resize_w = width;
+	cub->win->resize_h = height;
+	return (0);
+}
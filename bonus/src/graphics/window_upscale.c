@@ -0,0 +1,117 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Agrandit une ligne de la vue 3D à la largeur de la fenêtre.
+ *
+ * Les colonnes sont parcourues de droite à gauche: la colonne source d'un
+ * pixel n'est jamais à sa droite, elle est donc lue avant d'être écrasée
+ * quand la source et la destination sont la même ligne.
+ *
+ * @param dst La ligne de destination.
+ * @param src La ligne de la vue 3D.
+ * @param width La largeur de la fenêtre.
+ * @param step La largeur de la vue 3D divisée par celle de la fenêtre, en
+ * virgule fixe 16.16.
+ */
+static void	upscale_row(unsigned int *dst, unsigned int *src, int width,
+		int step)
+{
+	int	x;
+
+	x = width;
+	while (x-- > 0)
+		dst[x] = src[(x * step) >> 16];
+}
+
+/**
+ * @brief Agrandit une ligne d'un facteur entier, sans calcul par pixel.
+ *
+ * Chaque pixel source est recopié 'k' fois de suite, de droite à gauche
+ * pour la même raison que dans 'upscale_row'. Le facteur 2, le plus
+ * courant, a sa propre boucle sans boucle interne.
+ *
+ * @param dst La ligne de destination.
+ * @param src La ligne de la vue 3D.
+ * @param width La largeur de la vue 3D.
+ * @param k Le facteur d'agrandissement.
+ */
+static void	upscale_int(unsigned int *dst, unsigned int *src, int width, int k)
+{
+	unsigned int	*end;
+	unsigned int	p;
+	int				i;
+
+	end = dst + width * k;
+	while (k == 2 && width-- > 0)
+	{
+		p = src[width];
+		*--end = p;
+		*--end = p;
+	}
+	while (k != 2 && width-- > 0)
+	{
+		p = src[width];
+		i = k;
+		while (i-- > 0)
+			*--end = p;
+	}
+}
+
+/**
+ * @brief Agrandit une ligne source dans une ligne de l'image du jeu.
+ *
+ * Quand la largeur de la fenêtre est un multiple de celle de la vue (50 %
+ * ou 25 % d'une largeur paire), les pixels sont dupliqués; sinon chaque
+ * colonne est échantillonnée au plus proche voisin.
+ *
+ * @param w Pointeur vers la configuration de la fenêtre.
+ * @param dst La ligne de destination.
+ * @param src La ligne de la vue 3D.
+ */
+static void	upscale_line(t_WindowConfig *w, unsigned int *dst,
+		unsigned int *src)
+{
+	if (w->width % w->render_w == 0)
+		upscale_int(dst, src, w->render_w, w->width / w->render_w);
+	else
+		upscale_row(dst, src, w->width, (w->render_w << 16) / w->width);
+}
+
+/**
+ * @brief Agrandit la vue 3D à la taille de la fenêtre.
+ *
+ * La vue est rendue dans le coin supérieur gauche de l'image du jeu, à la
+ * résolution 'render_w' * 'render_h', puis agrandie sur place au plus
+ * proche voisin avant le dessin de l'interface, qui reste à la pleine
+ * résolution. Les lignes sont parcourues de bas en haut pour la même raison
+ * que les colonnes. Seule la dernière ligne écrite d'une même ligne source
+ * est calculée: les suivantes en sont une copie. Sans réduction, l'image
+ * est laissée telle quelle.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	window_upscale(t_Cub3d *cub)
+{
+	t_WindowConfig	*w;
+	char			*dst;
+	int				last;
+	int				src;
+	int				y;
+
+	w = cub->win;
+	if (w->render_w == w->width && w->render_h == w->height)
+		return ;
+	last = -1;
+	y = w->height;
+	while (y-- > 0)
+	{
+		dst = cub->img->addr + y * cub->img->len;
+		src = (long long)y * w->render_h / w->height;
+		if (src == last)
+			ft_memcpy(dst, dst + cub->img->len, w->width * 4);
+		else
+			upscale_line(w, (unsigned int *)dst,
+				(unsigned int *)(cub->img->addr + src * cub->img->len));
+		last = src;
+	}
+}
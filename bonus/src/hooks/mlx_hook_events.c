@@ -1,63 +1,52 @@
 #include "../../headers/cub3d.h"
 
 /**
- * @brief Gère l'événement d'appui sur une touche pour initier le mouvement du joueur.
+ * @brief Associe une touche du clavier à son bit d'entrée.
  *
- * La fonction 'move_press' est appelée lorsqu'un événement d'appui sur une touche est détecté.
- * Il vérifie le code de la clé et définit le drapeau de mouvement du joueur correspondant pour
- * indiquer la direction du mouvement. Cette fonction est principalement utilisée pour initier
- * le mouvement du joueur lorsque des touches telles que HAUT, BAS, GAUCHE ou DROITE sont enfoncées.
+ * La fonction 'input_bit' renvoie le bit INPUT_* correspondant aux touches
+ * de déplacement et de rotation, ainsi qu'à la touche USE. Ces bits sont
+ * consommés par la simulation au tick suivant avec 'sim_input'.
  *
- * @param key Le code de la touche enfoncée.
- * @param cub Pointeur vers la structure 't_Cub3d'.
- * @return Renvoie 0 après avoir défini l'indicateur de mouvement du joueur, ou 1 si un invalide
- * le code clé est fourni.
+ * @param key Le code de la touche.
+ * @return Le bit d'entrée de la touche, ou 0 si la touche n'en a pas.
  */
-int	move_press(int key, t_Cub3d *cub)
+static int	input_bit(int key)
 {
 	if (key == UP)
-		return (cub->player->up = 1, 0);
+		return (INPUT_UP);
 	else if (key == DOWN)
-		return (cub->player->down = 1, 0);
+		return (INPUT_DOWN);
 	else if (key == LEFT)
-		return (cub->player->left = 1, 0);
+		return (INPUT_LEFT);
 	else if (key == RIGHT)
-		return (cub->player->right = 1, 0);
+		return (INPUT_RIGHT);
 	else if (key == L_ARROW)
-		return (cub->player->l_key = 1, 0);
+		return (INPUT_L_KEY);
 	else if (key == R_ARROW)
-		return (cub->player->r_key = 1, 0);
-	return (1);
+		return (INPUT_R_KEY);
+	else if (key == USE)
+		return (INPUT_USE);
+	return (0);
 }
 
 /**
- * @brief Gère l'événement de relâchement de touche pour arrêter le mouvement du joueur.
+ * @brief Gère l'événement de fermeture de la fenêtre dans le jeu Cub3D.
  *
- * La fonction 'move_release' est appelée lorsqu'un événement de relâchement de clé est
- * detected. Il vérifie le code de la clé et efface le drapeau de mouvement du joueur
- * correspondant pour indiquer que le mouvement dans cette direction doit s'arrêter.
- * Cette fonction est principalement utilisée pour arrêter le mouvement du joueur lorsque
- * des touches telles que HAUT, BAS, GAUCHE ou DROITE sont relâchées.
+ * La fonction win_close est responsable de la gestion de l'événement de fermeture de 
+ * fenêtre dans l'application Cub3D. Lorsqu'il est déclenché, il effectue des opérations
+ * de nettoyage en appelant la fonction free_main pour libérer les ressources allouées
+ * et assurer un arrêt propre de l'application. De plus, il affiche un message indiquant
+ * la fermeture de jeu. Le paramètre 'false' passé à la fonction d'arrêt indique que jeu
+ * doit se terminer avec un statut réussi (EXIT_SUCCESS), l'empêchant de planter en raison
+ * d'erreurs.
  *
- * @param key Le code de clé de la clé libérée.
- * @param cub Pointeur vers la structure 't_Cub3d'.
- * @return Renvoie 0 après avoir effacé l'indicateur de mouvement du joueur, ou 1 si un code de clé invalide est fourni.
+ * @param cub Pointeur vers la structure t_Cub3d contenant les données du programme.
  */
-int	move_release(int key, t_Cub3d *cub)
+int	win_close(t_Cub3d *cub)
 {
-	if (key == UP)
-		return (cub->player->up = 0, 0);
-	else if (key == DOWN)
-		return (cub->player->down = 0, 0);
-	else if (key == LEFT)
-		return (cub->player->left = 0, 0);
-	else if (key == RIGHT)
-		return (cub->player->right = 0, 0);
-	else if (key == L_ARROW)
-		return (cub->player->l_key = 0, 0);
-	else if (key == R_ARROW)
-		return (cub->player->r_key = 0, 0);
-	return (0);
+	free_main(cub);
+	printf("Closing CUB3D\n");
+	exit(EXIT_SUCCESS);
 }
 
 /**
@@ -65,7 +54,11 @@ int	move_release(int key, t_Cub3d *cub)
  *
  * La fonction 'on_key_press' est responsable du traitement des événements d'appui sur les touches. Il vérifie le code
  * de la touche et effectue les actions correspondantes telles que la fermeture de la fenêtre lorsque la touche ÉCHAP est enfoncée.
- * De plus, il appelle la fonction 'move_press' pour gérer les mouvements du joueur en fonction des touches enfoncées.
+ * De plus, il ajoute le bit de la touche enfoncée à 'cub->sim->input'; les mouvements du joueur et
+ * l'action de la touche USE sont appliqués au prochain tick de la simulation.
+ * La touche F3 affiche ou masque l'overlay du profileur, la touche F4 la
+ * carte de chaleur des pas du DDA; les deux demandent le rendu de la frame
+ * suivante.
  *
  * @param key Le code de la touche enfoncée.
  * @param cub Pointeur vers la structure 't_Cub3d'.
@@ -75,9 +68,13 @@ int	on_key_press(int key, t_Cub3d *cub)
 {
 	if (key == ESC)
 		win_close(cub);
-	move_press(key, cub);
-	if (key == USE)
-		use_action(cub->player, cub->map);
+	atomic_fetch_or(&cub->sim->input, input_bit(key));
+	if (key == F3)
+		cub->prof->overlay = !cub->prof->overlay;
+	if (key == F4)
+		cub->prof->heatmap = !cub->prof->heatmap;
+	if (key == F3 || key == F4)
+		cub->redraw = true;
 	return (0);
 }
 
@@ -86,8 +83,8 @@ int	on_key_press(int key, t_Cub3d *cub)
  *
  * La fonction 'on_key_release' est responsable du traitement des événements de libération de clé.
  * Il vérifie le code de la touche et effectue les actions correspondantes telles que la fermeture de
- * la fenêtre lorsque la touche ÉCHAP est relâchée. De plus, il appelle la fonction 'move_release'
- * pour arrêter le mouvement du joueur en fonction des touches relâchées.
+ * la fenêtre lorsque la touche ÉCHAP est relâchée. De plus, il retire de 'cub->sim->input' le bit
+ * de la touche de déplacement relâchée; une action demandée reste en attente du prochain tick.
  *
  * @param key Le code de clé de la clé libérée.
  * @param cub Pointeur vers la structure 't_Cub3d'.
@@ -98,8 +95,7 @@ int	on_key_release(int key, t_Cub3d *cub)
 {
 	if (key == ESC)
 		win_close(cub);
-	if (move_release(key, cub))
-		return (0);
+	atomic_fetch_and(&cub->sim->input, ~(input_bit(key) & INPUT_HELD));
 	return (0);
 }
 
@@ -108,9 +104,10 @@ int	on_key_release(int key, t_Cub3d *cub)
  *
  * La fonction 'hook_events' enregistre les hooks d'événements pour diverses interactions utilisateur
  * dans la fenêtre Cub3D. Ces crochets incluent la gestion de la fermeture de la fenêtre, des événements
- * d'appui sur les touches, des événements de relâchement des touches et des événements d'appui sur
- * le bouton de la souris. Lorsque ces événements se produisent, les fonctions correspondantes sont
- * appelées pour gérer la réponse de l'application.
+ * d'appui sur les touches, des événements de relâchement des touches, des événements d'appui sur
+ * le bouton de la souris et des déplacements de la souris. Lorsque ces événements se produisent, les fonctions correspondantes sont
+ * appelées pour gérer la réponse de l'application. Le redimensionnement
+ * (ConfigureNotify) et l'exposition (Expose) de la fenêtre sont aussi suivis.
  *
  * @param cub Pointeur vers la structure t_Cub3d .
  */
@@ -120,4 +117,8 @@ void	hook_events(t_Cub3d *cub)
 	mlx_hook(cub->win_ptr, KeyPress, KeyPressMask, on_key_press, cub);
 	mlx_hook(cub->win_ptr, KeyRelease, KeyReleaseMask, on_key_release, cub);
 	mlx_hook(cub->win_ptr, ButtonPress, ButtonPressMask, mouse_hook, cub);
+	mlx_hook(cub->win_ptr, MotionNotify, PointerMotionMask, on_mouse_move, cub);
+	mlx_hook(cub->win_ptr, ConfigureNotify, StructureNotifyMask,
+		on_window_configure, cub);
+	mlx_expose_hook(cub->win_ptr, on_window_expose, cub);
 }
\ No newline at end of file
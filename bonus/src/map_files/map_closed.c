@@ -5,8 +5,8 @@
  *
  * Cette fonction vérifie si les limites supérieure et inférieure de la carte sont
  * correctement fermées, en s'assurant que tous les éléments le long de ces limites
- * sont soit '1' (mur), soit un espace vide ' '. Si d'autres caractères sont trouvés
- * le long de ces limites, la fonction renvoie 1 pour indiquer une erreur.
+ * sont soit des murs ('1' ou un matériau), soit un espace vide ' '. Si d'autres
+ * caractères sont trouvés le long de ces limites, la fonction renvoie 1 pour indiquer une erreur.
  * Sinon, il renvoie 0 pour indiquer une validation réussie.
  *
  * Pointeur @ param cub vers la structure t_Cub3d contenant le contexte et les données du programme.
@@ -21,14 +21,14 @@ static int	check_top_bot_closed(t_MapConfig *m)
 	last_row = m->n_lines;
 	while (m->matrix[0][i])
 	{
-		if (!ft_strchr("1 ", m->matrix[0][i]))
+		if (m->matrix[0][i] != ' ' && !is_wall(m->matrix[0][i]))
 			return (1);
 		i++;
 	}
 	i = 0;
 	while (m->matrix[last_row][i])
 	{
-		if (!ft_strchr("1 ", m->matrix[last_row][i]))
+		if (m->matrix[last_row][i] != ' ' && !is_wall(m->matrix[last_row][i]))
 			return (1);
 		i++;
 	}
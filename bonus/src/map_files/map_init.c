@@ -47,7 +47,8 @@ static void	tex_init(t_Cub3d *cub)
  *
  * Cette fonction initialise la configuration et les données de la carte dans Cub3D.
  * Il alloue de la mémoire pour une structure 't_MapConfig' et initialise ses membres.
- * La fonction met le compteur de sauts à 0 et duplique le nom de fichier fourni.
+ * La structure est mise à zéro par 'ft_calloc', puis le nom de fichier fourni est
+ * dupliqué. Avec '--trace', cette allocation apparaît dans la chronologie.
  * Si l'allocation de mémoire échoue, la fonction appelle `free_main ' pour nettoyer les
  * ressources allouées et termine le programme avec un message d'erreur.
  *
@@ -65,15 +66,15 @@ static void	tex_init(t_Cub3d *cub)
 
 int	map_init(t_Cub3d *cub, char *file)
 {
+	trace_event(cub->trace, "map_calloc", 'B', NULL);
 	cub->map = ft_calloc(1, sizeof(t_MapConfig));
+	trace_event(cub->trace, "map_calloc", 'E', NULL);
 	if (!cub->map)
 	{
 		free_main(cub);
 		printf("Error: fatal: t_MapConfig not created\n");
 		exit(EXIT_FAILURE);
 	}
-	cub->map->skip_counter = 0;
-	cub->map->max_line_len = 0;
 	cub->map->filename = ft_strdup(file);
 	tex_init(cub);
 	if (player_init(cub))
@@ -87,5 +88,7 @@ int	map_init(t_Cub3d *cub, char *file)
 		return (printf("Error: failed creating matrix\n"), 1);
 	if (check_map_closed(cub))
 		return (printf("Error: map isn't closed off\n"), 1);
+	if (init_doors(cub->map))
+		return (printf("Error: failed creating door table\n"), 1);
 	return (0);
 }
\ No newline at end of file
@@ -124,7 +124,7 @@ int	set_player_orientation(t_Cub3d *cub, char c)
 		charset = "019\n\t ";
 	if (ft_strchr("NSEW", c) && !cub->player->orientation)
 		cub->player->orientation = c;
-	else if (!ft_strchr(charset, c))
+	else if (!ft_strchr(charset, c) && !material_cell(cub->map, c))
 		return (1);
 	return (0);
 }
@@ -80,7 +80,7 @@ void	draw_static_map(t_Cub3d *cub)
 		x = 0;
 		while (x < cub->map->max_line_len - 1)
 		{
-			if (ft_strchr("1", cub->map->matrix[y][x]))
+			if (is_wall(cub->map->matrix[y][x]))
 				draw_static_cube(cub, GREY);
 			else if (ft_strchr("0NSEW", cub->map->matrix[y][x]))
 				draw_static_cube(cub, WHITE);
@@ -112,8 +112,8 @@ void	init_minimap(t_Cub3d *cub)
  */
 int	draw_minimap(t_Cub3d *cub)
 {
-	cub->minimap->player_x = ((int)cub->player->pos_x) * 13;
-	cub->minimap->player_y = ((int)cub->player->pos_y) * 13;
+	cub->minimap->player_x = ((int)cub->sim->view.pos_x) * 13;
+	cub->minimap->player_y = ((int)cub->sim->view.pos_y) * 13;
 	if (cub->minimap->flag == 0)
 	{
 		draw_static_map(cub);
@@ -0,0 +1,137 @@
+#include "../headers/cub3d.h"
+
+/**
+ * @brief Affiche l'utilisation du programme et termine avec une erreur.
+ *
+ * @param msg Le message d'erreur à afficher avant l'utilisation.
+ */
+void	usage_exit(char *msg)
+{
+	printf("Error: %s\n", msg);
+	printf("Usage: ./cub3D [--fps N] [--tick-rate N] [--sim-thread]");
+	printf(" [--sync flush|shm|N] [--profile-out file.csv] [--perf]");
+	printf(" [--trace file.json] [--heatmap]");
+	printf(" [--size WxH] [--scale PCT] [--frame-budget MS] [--column-major]");
+	printf(" [--indexed]");
+	printf(" [--bench [--path path.txt] [--frames N]]");
+	printf(" [--record file | --replay file [--replay-fast] [--headless]]");
+	printf(" [--capture out.y4m|prefix] [--golden dir [--golden-update]]");
+	printf(" map.cub\n");
+	exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Lit la valeur numérique qui suit une option.
+ *
+ * La fonction 'option_value' vérifie qu'un argument suit l'option à l'index
+ * 'i' et qu'il s'agit d'un entier positif ou nul, puis le renvoie.
+ *
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ * @return La valeur entière de l'argument qui suit l'option.
+ */
+int	option_value(int ac, char **av, int i)
+{
+	if (i + 1 >= ac || !ft_isnumeric(av[i + 1]) || ft_atoi(av[i + 1]) < 0)
+		usage_exit("Option expects a non-negative number");
+	return (ft_atoi(av[i + 1]));
+}
+
+/**
+ * @brief Lit la politique de synchronisation X qui suit l'option '--sync'.
+ *
+ * La valeur 'flush' se contente de vider le tampon de requêtes à chaque frame,
+ * 'shm' attend la fin de la copie XShm de la frame précédente et un nombre N
+ * effectue un aller-retour XSync toutes les N frames.
+ *
+ * @param o Pointeur vers les options à remplir.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ */
+static void	sync_value(t_Options *o, int ac, char **av, int i)
+{
+	if (i + 1 < ac && !ft_strncmp(av[i + 1], "flush", 6))
+		o->sync_policy = MLX_SYNC_FLUSH;
+	else if (i + 1 < ac && !ft_strncmp(av[i + 1], "shm", 4))
+		o->sync_policy = MLX_SYNC_SHM;
+	else
+	{
+		o->sync_policy = MLX_SYNC_EVERY;
+		o->sync_every = option_value(ac, av, i);
+		if (!o->sync_every)
+			usage_exit("--sync expects flush, shm or a number of frames");
+	}
+}
+
+/**
+ * @brief Analyse une option de la ligne de commande.
+ *
+ * @param o Pointeur vers les options à remplir.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'argument à analyser dans 'av'.
+ * @return L'index du dernier argument consommé.
+ */
+static int	parse_option(t_Options *o, int ac, char **av, int i)
+{
+	if (!ft_strncmp(av[i], "--fps", 6))
+		o->target_fps = option_value(ac, av, i++);
+	else if (!ft_strncmp(av[i], "--tick-rate", 12))
+		o->tick_rate = option_value(ac, av, i++);
+	else if (!ft_strncmp(av[i], "--sim-thread", 13))
+		o->sim_thread = true;
+	else if (!ft_strncmp(av[i], "--sync", 7))
+		sync_value(o, ac, av, i++);
+	else if (!ft_strncmp(av[i], "--profile-out", 14) && i + 1 < ac)
+		o->profile_out = av[++i];
+	else if (!ft_strncmp(av[i], "--perf", 7))
+		o->perf = true;
+	else if (!ft_strncmp(av[i], "--trace", 8) && i + 1 < ac)
+		o->trace = av[++i];
+	else if (!ft_strncmp(av[i], "--heatmap", 10))
+		o->heatmap = true;
+	else if (av[i][0] == '-')
+		i = parse_run_option(o, ac, av, i);
+	else if (o->map_file)
+		usage_exit("Unknown option or extra argument");
+	else
+		o->map_file = av[i];
+	return (i);
+}
+
+/**
+ * @brief Analyse les arguments de la ligne de commande.
+ *
+ * La fonction 'parse_options' alloue la structure 't_Options', applique les
+ * valeurs par défaut puis parcourt les arguments. Les options reconnues sont
+ * consommées avec leur valeur; le seul argument positionnel accepté est le
+ * fichier de carte '.cub'. Toute option inconnue, argument manquant ou
+ * combinaison d'options invalide ('check_options') termine le programme avec
+ * un message d'utilisation.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ */
+void	parse_options(t_Cub3d *cub, int ac, char **av)
+{
+	int	i;
+
+	cub->opt = ft_calloc(1, sizeof(t_Options));
+	if (!cub->opt)
+		usage_exit("fatal: t_Options not created");
+	cub->opt->target_fps = TARGET_FPS;
+	cub->opt->tick_rate = SIM_HZ;
+	cub->opt->sync_policy = MLX_SYNC_FLUSH;
+	cub->opt->sync_every = 1;
+	cub->opt->bench_frames = -1;
+	i = 1;
+	while (i < ac)
+	{
+		i = parse_option(cub->opt, ac, av, i);
+		i++;
+	}
+	check_options(cub->opt);
+}
@@ -63,8 +63,8 @@ void	draw_gun(t_Cub3d *cub, t_PlayerConfig *p, int x, int y)
 		{
 			color = my_mlx_pixel_get(p->gun->img, x, y);
 			if (!check_tolerance(color, 'p'))
-				my_mlx_pixel_put(cub->img, WINDOW_X - 760 + x,
-					WINDOW_Y - 530 + y, color);
+				my_mlx_pixel_put(cub->img, cub->win->width - 760 + x,
+					cub->win->height - 530 + y, color);
 			y++;
 		}
 		x++;
@@ -97,8 +97,9 @@ void	draw_crosshair(t_Cub3d *cub, t_PlayerConfig *p, int x, int y)
 			color = my_mlx_pixel_get(p->crosshair->img, x, y);
 			if (!check_tolerance(color, 'b'))
 				my_mlx_pixel_put(cub->img,
-					(WINDOW_X / 2) - (p->crosshair->img->width / 2) + x,
-					(WINDOW_Y / 2) - (p->crosshair->img->height / 2) + y,
+					(cub->win->width / 2) - (p->crosshair->img->width / 2) + x,
+					(cub->win->height / 2) - (p->crosshair->img->height / 2)
+					+ y,
 					color);
 			y++;
 		}
@@ -1,24 +1,31 @@
 #include "../../headers/cub3d.h"
 
-static void	rotate_player_keys(t_Cub3d *cub, int dir)
+/**
+ * @brief Fait pivoter la direction du joueur et le plan de la caméra.
+ *
+ * La rotation est donnée par le cosinus et le sinus de son angle: la
+ * rotation d'un tick au clavier, d'angle constant, utilise les valeurs
+ * calculées une fois par 'sim_init' ('rot_cos' et 'rot_sin').
+ *
+ * @param cub Pointeur vers la structure 't_Cub3d'.
+ * @param cs Le cosinus de l'angle de rotation.
+ * @param sn Le sinus de l'angle de rotation.
+ */
+void	rotate_view(t_Cub3d *cub, double cs, double sn)
 {
 	t_PlayerConfig	*p;
 	t_CameraConfig	*c;
 	t_Transform		rot_dir;
 	t_Transform		rot_plane;
-	double			angle;
 
-	angle = 0.1;
-	if (!dir)
-		angle = -0.1;
 	c = cub->cam;
 	p = cub->player;
-	rot_dir.x = p->dir_x * cos(angle) - p->dir_y * sin(angle);
-	rot_dir.y = p->dir_x * sin(angle) + p->dir_y * cos(angle);
+	rot_dir.x = p->dir_x * cs - p->dir_y * sn;
+	rot_dir.y = p->dir_x * sn + p->dir_y * cs;
 	p->dir_x = rot_dir.x;
 	p->dir_y = rot_dir.y;
-	rot_plane.x = c->plane_x * cos(angle) - c->plane_y * sin(angle);
-	rot_plane.y = c->plane_x * sin(angle) + c->plane_y * cos(angle);
+	rot_plane.x = c->plane_x * cs - c->plane_y * sn;
+	rot_plane.y = c->plane_x * sn + c->plane_y * cs;
 	c->plane_x = rot_plane.x;
 	c->plane_y = rot_plane.y;
 }
@@ -29,7 +36,7 @@ static void	rotate_player_keys(t_Cub3d *cub, int dir)
  *
  * La fonction `check_wall_hit` examine la nouvelle position potentielle
  * du joueur (spécifiée par 'temp_x' et 'temp_y'` et vérifie si elle entre
- * en collision avec un mur de la carte du jeu. Si une collision est détectée,
+ * en collision avec un mur de la carte de la simulation ('world'). Si une collision est détectée,
  * la position du joueur est mise à jour aux coordonnées spécifiées, empêchant
  * le joueur de se déplacer à travers les murs.
  *
@@ -44,8 +51,8 @@ void	check_wall_hit(t_Cub3d *cub, double temp_x, double temp_y)
 
 	m = cub->map;
 	p = cub->player;
-	if (m->matrix[(int)p->pos_y][(int)p->pos_x] == '1'
-		|| m->matrix[(int)p->pos_y][(int)p->pos_x] == '9')
+	if (m->world[(int)p->pos_y][(int)p->pos_x] >= '1'
+		&& m->world[(int)p->pos_y][(int)p->pos_x] <= '9')
 	{
 		p->pos_y = temp_y;
 		p->pos_x = temp_x;
@@ -59,7 +66,8 @@ void	check_wall_hit(t_Cub3d *cub, double temp_x, double temp_y)
  * lorsqu'il avance ou recule (spécifiée par le paramètre `dir`) dans sa
  * direction actuelle. Il met à jour les coordonnées X et Y du joueur en
  * fonction de la direction, du vecteur de direction et d'une distance de
- * déplacement fixe. La fonction appelle ensuite 'check_wall_hit' pour
+ * déplacement proportionnelle à la durée d'un tick ('MOVE_SPEED' par tick
+ * de référence). La fonction appelle ensuite 'check_wall_hit' pour
  * détecter et gérer les collisions avec les murs.
  *
  * @param cub Pointeur vers la structure 't_Cub3d'.
@@ -74,8 +82,8 @@ void	apply_for_back_move(t_Cub3d *cub, t_PlayerConfig *p, int dir)
 
 	temp_x = p->pos_x;
 	temp_y = p->pos_y;
-	p->pos_x += 0.2 * p->dir_x * dir;
-	p->pos_y += 0.2 * p->dir_y * dir;
+	p->pos_x += MOVE_SPEED * cub->sim->step_scale * p->dir_x * dir;
+	p->pos_y += MOVE_SPEED * cub->sim->step_scale * p->dir_y * dir;
 	check_wall_hit(cub, temp_x, temp_y);
 }
 
@@ -86,7 +94,8 @@ void	apply_for_back_move(t_Cub3d *cub, t_PlayerConfig *p, int dir)
  * joueur lorsqu'il mitraille à gauche ou à droite (spécifiée par le paramètre
  * `dir`) par rapport à sa direction actuelle. Il met à jour les coordonnées X
  * et Y du joueur en fonction de la direction, du vecteur de direction
- * et d'une distance de déplacement fixe. La fonction appelle ensuite `check_wall_hit`
+ * et d'une distance proportionnelle à la durée d'un tick. La fonction
+ * appelle ensuite `check_wall_hit`
  * pour détecter et gérer les collisions avec les murs.
  *
  * @param cub Pointeur vers la structure 't_Cub3d'.
@@ -98,18 +107,20 @@ void	apply_left_right_move(t_Cub3d *cub, t_PlayerConfig *p, int dir)
 {
 	double	temp_x;
 	double	temp_y;
+	double	step;
 
 	temp_x = p->pos_x;
 	temp_y = p->pos_y;
+	step = MOVE_SPEED * cub->sim->step_scale;
 	if (dir)
 	{
-		p->pos_x += p->dir_y * 0.2;
-		p->pos_y += -p->dir_x * 0.2;
+		p->pos_x += p->dir_y * step;
+		p->pos_y += -p->dir_x * step;
 	}
 	else
 	{
-		p->pos_x += -p->dir_y * 0.2;
-		p->pos_y += p->dir_x * 0.2;
+		p->pos_x += -p->dir_y * step;
+		p->pos_y += p->dir_x * step;
 	}
 	check_wall_hit(cub, temp_x, temp_y);
 }
@@ -124,10 +135,10 @@ void	apply_left_right_move(t_Cub3d *cub, t_PlayerConfig *p, int dir)
  * `apply_for_back_move` et `apply_left_right_move`. Ces fonctions calculent
  * la nouvelle position du joueur en fonction de la direction et de la distance
  * spécifiées par les touches de déplacement.
- * La fonction `on_mouse_move` est également appelée pour gérer le contrôle de
- * vue basé sur la souris. Si des touches de mouvement sont enfoncées ou s'il
- * y a un mouvement de la souris, la fonction renvoie 0 pour indiquer un mouvement
- * réussi; sinon, il renvoie 1 pour indiquer aucun mouvement.
+ * La fonction `apply_mouse_look` est également appelée pour appliquer le
+ * déplacement de la souris accumulé depuis le tick précédent, puis l'action
+ * d'utilisation demandée au clavier est exécutée. `readmove` est appelée une
+ * fois par tick de la simulation.
  *
  * @param cub Pointeur vers la structure 't_Cub3d'.
  * @param p Pointeur vers la structure 't_PlayerConfig' contenant les données
@@ -147,9 +158,14 @@ int	readmove(t_Cub3d *cub, t_PlayerConfig *p)
 	if (p->right)
 		apply_left_right_move(cub, p, 0);
 	if (p->l_key)
-		rotate_player_keys(cub, 0);
+		rotate_view(cub, cub->sim->rot_cos, -cub->sim->rot_sin);
 	if (p->r_key)
-		rotate_player_keys(cub, 1);
-	on_mouse_move(cub);
+		rotate_view(cub, cub->sim->rot_cos, cub->sim->rot_sin);
+	apply_mouse_look(cub);
+	if (p->use)
+	{
+		use_action(p, cub->map);
+		p->use = 0;
+	}
 	return (0);
 }
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Ajoute les compteurs du rendu de la frame courante.
+ *
+ * Appelée après la passe de texture, la fonction 'stats_rays' parcourt la
+ * table des impacts: nombre de pas du DDA de chaque colonne, pixels de mur
+ * écrits et colonnes dont le rayon touche une porte. La taille de la vue 3D
+ * est gardée avec les compteurs. Les texels sont comptés là où la passe de
+ * texture les lit ('reads' de l'atlas). Les compteurs du cache des tables
+ * de lignes de texture sont ajoutés aussi.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	stats_rays(t_Cub3d *cub)
+{
+	t_RenderStats	*s;
+	t_RayHit		*h;
+	int				x;
+
+	s = &cub->prof->rs;
+	s->columns = cub->win->render_w;
+	s->pixels = (long long)cub->win->render_w * cub->win->render_h;
+	x = 0;
+	while (x < s->columns)
+	{
+		h = &cub->cam->hits[x];
+		s->steps += h->steps;
+		if (h->steps > s->max_steps)
+			s->max_steps = h->steps;
+		s->wall_px += h->draw_end - h->draw_start;
+		if (h->wall_dir == 9)
+			s->doors++;
+		x++;
+	}
+	s->texels += cub->atlas->reads;
+	cub->atlas->reads = 0;
+	scaler_stats(cub, s);
+}
+
+/**
+ * @brief Renvoie la couleur de la carte de chaleur d'un nombre de pas.
+ *
+ * L'échelle va du bleu (un pas) au rouge (STATS_HEAT_MAX pas ou plus), en
+ * passant par le cyan, le vert et le jaune. Elle est fixe, pour que les
+ * frames et les cartes restent comparables.
+ *
+ * @param steps Le nombre de pas du DDA de la colonne.
+ * @return La couleur au format 0xRRGGBB.
+ */
+static unsigned int	heat_color(int steps)
+{
+	int	v;
+
+	v = steps * 1020 / STATS_HEAT_MAX;
+	if (v > 1020)
+		v = 1020;
+	if (v < 256)
+		return (v << 8 | 255);
+	if (v < 511)
+		return (255 << 8 | (510 - v));
+	if (v < 766)
+		return ((v - 510) << 16 | 255 << 8);
+	return (255 << 16 | (1020 - v) << 8);
+}
+
+/**
+ * @brief Remplace la vue par la carte de chaleur des pas du DDA.
+ *
+ * Chaque colonne prend la couleur de son nombre de pas: vive sur le mur
+ * touché, assombrie au-dessus et au-dessous pour garder la géométrie de la
+ * scène lisible. Ces écritures ne sont pas comptées dans les statistiques.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	stats_heatmap(t_Cub3d *cub)
+{
+	t_RayHit		*h;
+	unsigned int	*px;
+	unsigned int	c;
+	int				x;
+	int				y;
+
+	x = 0;
+	while (x < cub->win->render_w)
+	{
+		h = &cub->cam->hits[x];
+		c = heat_color(h->steps);
+		y = 0;
+		while (y < cub->win->render_h)
+		{
+			px = (unsigned int *)(cub->img->addr + y * cub->img->len
+					+ x * (cub->img->bpp / 8));
+			*px = (c >> 2) & 0x3F3F3F;
+			if (y > h->draw_start && y <= h->draw_end)
+				*px = c;
+			y++;
+		}
+		x++;
+	}
+}
+
+/**
+ * @brief Clôt les compteurs du rendu de la frame.
+ *
+ * Le sol et le plafond écrivent chaque pixel de la vue 3D: toute écriture
+ * au-delà de sa taille en recouvre une autre et compte comme surcharge.
+ * L'agrandissement de la vue n'est pas compté. Les compteurs sont écrits
+ * dans le fichier CSV, gardés pour l'overlay puis remis à zéro, avant les
+ * compteurs matériels.
+ *
+ * @param p Pointeur vers le profileur.
+ */
+void	stats_frame_end(t_Profiler *p)
+{
+	t_RenderStats	*s;
+
+	s = &p->rs;
+	s->overdraw = 0;
+	if (s->writes > s->pixels)
+		s->overdraw = s->writes - s->pixels;
+	if (p->csv)
+		fprintf(p->csv, ",%lld,%d,%lld,%lld,%lld,%lld,%d,%lld,%lld,%lld",
+			s->steps, s->max_steps, s->wall_px, s->texels, s->writes,
+			s->overdraw, s->doors, s->scaler_hits, s->scaler_misses,
+			s->scaler_bytes / 1024);
+	p->last = *s;
+	ft_bzero(s, sizeof(t_RenderStats));
+	if (p->perf)
+		perf_frame_end(p);
+}
+
+/**
+ * @brief Ajoute à l'en-tête CSV les colonnes des compteurs du rendu, puis
+ * celles des compteurs matériels.
+ *
+ * @param p Pointeur vers le profileur.
+ */
+void	stats_csv_header(t_Profiler *p)
+{
+	fprintf(p->csv, ",dda_steps,dda_max_steps,wall_px,texels,px_writes"
+		",overdraw,door_columns,scaler_hits,scaler_misses,scaler_kb");
+	if (p->perf)
+		perf_csv_header(p);
+}
@@ -6,7 +6,7 @@
  * La fonction `cub3d_new_image` est responsable de la création d'un nouveau tampon
  * d'image pour la fenêtre du jeu Cub3D. Elle commence par détruire l'image existante
  * si une existe déjà, puis alloue une nouvelle image avec des dimensions spécifiées par
- * les constantes de taille de la fenêtre (WINDOW_X et WINDOW_Y). Elle met également à jour
+ * la taille courante de la fenêtre ('cub->win'). Elle met également à jour
  * l'adresse de l'image, le nombre de bits par pixel (bpp), la longueur de la ligne (len),
  * et l'ordre des octets (endian) pour la nouvelle image.
  *
@@ -15,9 +15,12 @@
 void	cub3d_new_image(t_Cub3d *cub)
 {
 	mlx_destroy_image(cub->mlx_ptr, cub->img->img_ptr);
-	cub->img->img_ptr = mlx_new_image(cub->mlx_ptr, WINDOW_X, WINDOW_Y);
+	cub->img->img_ptr = mlx_new_image(cub->mlx_ptr, cub->win->width,
+			cub->win->height);
 	cub->img->addr = mlx_get_data_addr(cub->img->img_ptr, &cub->img->bpp,
 			&cub->img->len, &cub->img->endian);
+	cub->img->width = cub->win->width;
+	cub->img->height = cub->win->height;
 }
 
 /**
@@ -43,12 +46,16 @@ int	my_mlx_pixel_get(t_ImageControl *img, int x, int y)
  * @brief Initialise les propriétés d'un rayon pour une colonne spécifique de l'écran.
  *
  * La fonction `init_rays` initialise les propriétés d'un rayon pour une colonne
- * spécifique de l'écran pendant le processus de raycasting. Elle calcule la
- * position de la caméra sur l'écran (`camera_x`), la direction du rayon (`raydir_x`
- * et `raydir_y`), et la position initiale sur la carte (`map_x` et `map_y`).
- * De plus, elle calcule la distance delta (`ddist_x` et `ddist_y`)
- * nécessaire pour passer d'une cellule de grille à la suivante dans les directions
- * horizontale et verticale.
+ * spécifique de l'écran pendant le processus de raycasting. Elle lit la
+ * direction du rayon (`raydir_x` et `raydir_y`) et la distance delta
+ * (`ddist_x` et `ddist_y`) dans la table 'cub->cam->rays', mise à jour par
+ * 'ray_table_update', et calcule la position initiale sur la carte (`map_x`
+ * et `map_y`). La pose utilisée est la vue interpolée de la
+ * simulation ('cub->sim->view'), jamais l'état courant du joueur. Le rayon
+ * reçoit aussi la résolution de la vue 3D ('cub->win'). Avec le moteur
+ * FIXED_POINT, le rayon et la position de la caméra en virgule fixe sont
+ * copiés, et la cellule de départ est la partie entière de la position,
+ * sans appel à 'floor'.
  *
  * @param cub Pointeur vers la structure `t_Cub3d` contenant le contexte du programme
  * et les données.
@@ -58,50 +65,62 @@ int	my_mlx_pixel_get(t_ImageControl *img, int x, int y)
  */
 void	init_rays(t_Cub3d *cub, t_CameraConfig *cam, int x)
 {
-	cam->camera_x = 2 * x / (double)WINDOW_X - 1;
-	cam->raydir_x = cub->player->dir_x + cam->plane_x * cam->camera_x;
-	cam->raydir_y = cub->player->dir_y + cam->plane_y * cam->camera_x;
-	cam->map_x = floor(cub->player->pos_x);
-	cam->map_y = floor(cub->player->pos_y);
-	if (!cam->raydir_x)
-		cam->ddist_x = 1e30;
-	else
-		cam->ddist_x = fabs(1 / cam->raydir_x);
-	if (!cam->raydir_y)
-		cam->ddist_y = 1e30;
-	else
-		cam->ddist_y = fabs(1 / cam->raydir_y);
+	t_SimState	*v;
+	t_RayDir	*r;
+
+	v = &cub->sim->view;
+	r = &cub->cam->rays[x];
+	cam->width = cub->win->render_w;
+	cam->height = cub->win->render_h;
+	cam->raydir_x = r->raydir_x;
+	cam->raydir_y = r->raydir_y;
+	cam->ddist_x = r->ddist_x;
+	cam->ddist_y = r->ddist_y;
+	if (FIXED_POINT)
+	{
+		cam->fx = r->fx;
+		cam->fpos_x = cub->cam->fpos_x;
+		cam->fpos_y = cub->cam->fpos_y;
+		cam->map_x = cam->fpos_x >> FIX_SHIFT;
+		cam->map_y = cam->fpos_y >> FIX_SHIFT;
+		return ;
+	}
+	cam->map_x = floor(v->pos_x);
+	cam->map_y = floor(v->pos_y);
 }
 
 /**
  * @brief Dessine la scène en lançant des rayons depuis la caméra pour chaque colonne de l'écran.
  *
- * La fonction `draw_rays` est responsable du rendu de la scène 3D en lançant
- * des rayons depuis la perspective de la caméra pour chaque colonne de l'écran.
- * Elle itère sur toutes les colonnes, initialise les propriétés du rayon, effectue
- * le lancer de rayons, calcule les hauteurs des murs, détermine les directions des
- * murs, et applique des textures pour rendre les murs. De plus, elle rend le plafond
- * et le sol avant de traiter chaque colonne.
+ * La fonction `draw_rays` est responsable du rendu de la scène 3D. Elle rend
+ * d'abord le plafond et le sol, puis procède en deux passes: 'cast_rays'
+ * lance un rayon par colonne et range les impacts (DDA, hauteur et direction
+ * des murs), puis 'texture_rays' dessine les colonnes de murs texturées.
+ * Avec '--column-major', le sol, le plafond et les murs sont écrits dans
+ * le tampon rangé par colonnes, puis transposés dans l'image du jeu.
+ * Chaque passe est mesurée séparément par le profileur, qui compte ensuite
+ * les pas du DDA et les pixels de mur; la carte de chaleur des pas remplace
+ * la vue si elle est activée (touche F4).
  *
  * @param cub Pointeur vers la structure `t_Cub3d` contenant le contexte et les données du programme.
  */
 void	draw_rays(t_Cub3d *cub)
 {
-	int				x;
-	t_CameraConfig	*cam;
-
-	cam = cub->cam;
-	x = 0;
-	cam_utils_init(cam);
+	cam_utils_init(cub->cam);
+	view_update(cub);
+	prof_begin(cub->prof, PROF_FLOOR);
 	render_ceilling_floor(cub);
-	while (x < WINDOW_X)
-	{
-		init_rays(cub, cam, x);
-		step_calculation(cam, cub->player);
-		apply_dda(cam, cub->map);
-		calculate_wall_height(cam);
-		get_wall_direction(cub->map, cub->cam);
-		apply_texture(cub, cub->cam, x, cam->wall_dir);
-		x++;
-	}
+	prof_end(cub->prof, PROF_FLOOR);
+	prof_begin(cub->prof, PROF_CAST);
+	cast_rays(cub);
+	prof_end(cub->prof, PROF_CAST);
+	prof_begin(cub->prof, PROF_TEXTURE);
+	texture_rays(cub);
+	prof_end(cub->prof, PROF_TEXTURE);
+	prof_begin(cub->prof, PROF_TRANSPOSE);
+	view_transpose(cub);
+	prof_end(cub->prof, PROF_TRANSPOSE);
+	stats_rays(cub);
+	if (cub->prof->heatmap)
+		stats_heatmap(cub);
 }
@@ -0,0 +1,104 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Lit le prochain événement de l'enregistrement rejoué.
+ *
+ * La fin de l'enregistrement est atteinte sur l'événement INPUT_END, qui
+ * donne le nombre exact de ticks joués, ou à la fin du fichier si la partie
+ * enregistrée s'est mal terminée; la relecture s'arrête alors après le
+ * dernier événement lu.
+ *
+ * @param r Pointeur vers la relecture.
+ * @return 1 si un événement a été lu, 0 à la fin de l'enregistrement.
+ */
+int	replay_next(t_Replay *r)
+{
+	r->has_next = false;
+	if (fread(&r->next, sizeof(t_ReplayEvent), 1, r->file) != 1)
+		return (0);
+	if (r->next.keys & INPUT_END)
+	{
+		r->end_tick = r->next.tick;
+		return (0);
+	}
+	r->end_tick = r->next.tick + 1;
+	r->has_next = true;
+	return (1);
+}
+
+/**
+ * @brief Enregistre les entrées du tick courant si elles ont changé.
+ *
+ * Un événement est écrit quand les touches maintenues changent, quand une
+ * action est demandée ou quand la souris a bougé. Le déplacement de la
+ * souris est borné à la taille de l'événement, et la valeur bornée est
+ * celle appliquée au joueur, pour que la relecture soit identique.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Pointeur vers l'enregistrement.
+ * @param in Les entrées du tick (INPUT_*).
+ */
+static void	record_tick(t_Cub3d *cub, t_Replay *r, int in)
+{
+	t_ReplayEvent	e;
+
+	if (in == r->held && !cub->sim->look_dx)
+		return ;
+	if (cub->sim->look_dx > SHRT_MAX)
+		cub->sim->look_dx = SHRT_MAX;
+	if (cub->sim->look_dx < -SHRT_MAX)
+		cub->sim->look_dx = -SHRT_MAX;
+	e.tick = cub->sim->ticks;
+	e.keys = in;
+	e.dx = cub->sim->look_dx;
+	fwrite(&e, sizeof(e), 1, r->file);
+	r->held = in & INPUT_HELD;
+}
+
+/**
+ * @brief Remplace les entrées du tick courant par celles de l'enregistrement.
+ *
+ * Entre deux événements, les touches maintenues restent celles du dernier
+ * événement et la souris ne bouge pas. Les entrées réelles du clavier et de
+ * la souris sont ignorées.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Pointeur vers la relecture.
+ * @return Les entrées du tick (INPUT_*).
+ */
+static int	play_tick(t_Cub3d *cub, t_Replay *r)
+{
+	int	in;
+
+	in = r->held;
+	cub->sim->look_dx = 0;
+	if (r->has_next && r->next.tick == cub->sim->ticks)
+	{
+		in = r->next.keys;
+		cub->sim->look_dx = r->next.dx;
+		r->held = in & INPUT_HELD;
+		replay_next(r);
+	}
+	return (in);
+}
+
+/**
+ * @brief Enregistre ou rejoue les entrées du tick courant.
+ *
+ * La fonction 'replay_tick' est appelée par 'sim_input' à chaque tick de la
+ * simulation, avec les entrées lues en direct. Les événements sont repérés
+ * par le numéro du tick et non par l'heure, ce qui permet de les rejouer
+ * exactement au même tick.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param in Les entrées lues en direct (INPUT_*).
+ * @return Les entrées à appliquer au tick courant.
+ */
+int	replay_tick(t_Cub3d *cub, int in)
+{
+	if (cub->replay->mode == REPLAY_PLAY)
+		return (play_tick(cub, cub->replay));
+	if (cub->replay->file)
+		record_tick(cub, cub->replay, in);
+	return (in);
+}
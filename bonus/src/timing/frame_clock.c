@@ -0,0 +1,112 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie le temps monotone courant en nanosecondes.
+ *
+ * La fonction 'get_time_ns' lit l'horloge CLOCK_MONOTONIC, qui n'est pas
+ * affectée par les changements de l'heure système. Elle sert de base à toutes
+ * les mesures de temps de frame du jeu.
+ *
+ * @return Le temps monotone courant en nanosecondes.
+ */
+long long	get_time_ns(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+/**
+ * @brief Initialise l'horloge de cadencement des frames.
+ *
+ * La fonction 'frame_clock_init' alloue la structure 't_FrameClock' et
+ * calcule la durée cible d'une frame à partir du nombre de FPS demandé.
+ * Un objectif de 0 FPS désactive la limitation: le jeu tourne alors aussi
+ * vite que possible, la simulation gardant sa propre cadence fixe.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param fps Le nombre de frames par seconde visé (0 pour illimité).
+ * @return 0 en cas de succès, 1 si l'allocation échoue.
+ */
+int	frame_clock_init(t_Cub3d *cub, int fps)
+{
+	cub->clock = ft_calloc(1, sizeof(t_FrameClock));
+	if (!cub->clock)
+		return (1);
+	cub->clock->target_ns = 0;
+	if (fps > 0)
+		cub->clock->target_ns = 1000000000LL / fps;
+	cub->clock->frame_time = 1.0 / REF_FPS;
+	cub->clock->avg_frame_time = cub->clock->frame_time;
+	cub->clock->frame_start = get_time_ns();
+	cub->clock->deadline = cub->clock->frame_start + cub->clock->target_ns;
+	return (0);
+}
+
+/**
+ * @brief Démarre une nouvelle frame et mesure la durée de la précédente.
+ *
+ * La fonction 'frame_begin' calcule le temps écoulé depuis le début de la
+ * frame précédente ('frame_time', en secondes), met à jour sa moyenne
+ * glissante ('avg_frame_time') et fixe l'échéance de la frame suivante.
+ * Si le jeu a pris plus d'une frame de retard, l'échéance est recalée sur
+ * l'instant présent au lieu d'enchaîner des frames sans pause pour
+ * rattraper le retard.
+ *
+ * @param c Pointeur vers l'horloge de frames.
+ */
+void	frame_begin(t_FrameClock *c)
+{
+	long long	now;
+
+	now = get_time_ns();
+	c->frame_time = (now - c->frame_start) / 1e9;
+	c->frame_start = now;
+	c->avg_frame_time += (c->frame_time - c->avg_frame_time) * 0.05;
+	c->deadline += c->target_ns;
+	if (c->deadline < now)
+		c->deadline = now + c->target_ns;
+}
+
+/**
+ * @brief Indique si l'échéance de la frame courante est atteinte.
+ *
+ * La fonction 'frame_ready' est appelée à chaque passage dans la boucle
+ * MiniLibX. Tant que l'échéance est à plus de SPIN_NS, elle attend sur la
+ * connexion X avec 'mlx_wait_event': le processus dort jusqu'à l'arrivée d'un
+ * événement ou jusqu'à SPIN_NS de l'échéance, puis rend la main à la boucle
+ * pour que l'événement soit traité sans attendre la frame suivante. Près de
+ * l'échéance, elle termine l'attente en scrutant l'horloge, ce qui absorbe
+ * l'imprécision de l'ordonnanceur.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 1 si une frame doit être rendue, 0 sinon.
+ */
+int	frame_ready(t_Cub3d *cub)
+{
+	long long	remaining;
+
+	if (!cub->clock->target_ns)
+		return (1);
+	remaining = cub->clock->deadline - get_time_ns();
+	if (remaining > SPIN_NS)
+	{
+		mlx_wait_event(cub->mlx_ptr, (remaining - SPIN_NS) / 1000000);
+		return (0);
+	}
+	while (get_time_ns() < cub->clock->deadline)
+		;
+	return (1);
+}
+
+/**
+ * @brief Renvoie la durée mesurée de la dernière frame.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return La durée de la dernière frame en secondes.
+ */
+double	get_frame_time(t_Cub3d *cub)
+{
+	return (cub->clock->frame_time);
+}
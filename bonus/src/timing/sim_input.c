@@ -0,0 +1,50 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Applique les entrées d'un tick aux flags du joueur.
+ *
+ * Les touches maintenues remplacent l'état des flags de déplacement et de
+ * rotation. Les actions demandées (utilisation, tir) ne font que lever leur
+ * flag, qui est remis à zéro par l'action elle-même.
+ *
+ * @param p Pointeur vers la structure 't_PlayerConfig'.
+ * @param in Les entrées du tick (INPUT_*).
+ */
+static void	input_apply(t_PlayerConfig *p, int in)
+{
+	p->up = (in & INPUT_UP) != 0;
+	p->down = (in & INPUT_DOWN) != 0;
+	p->left = (in & INPUT_LEFT) != 0;
+	p->right = (in & INPUT_RIGHT) != 0;
+	p->l_key = (in & INPUT_L_KEY) != 0;
+	p->r_key = (in & INPUT_R_KEY) != 0;
+	if (in & INPUT_USE)
+		p->use = 1;
+	if (in & INPUT_SHOOT)
+		p->shoot = 1;
+}
+
+/**
+ * @brief Lit les entrées consommées par le tick courant de la simulation.
+ *
+ * La fonction 'sim_input' récupère atomiquement les touches enfoncées et les
+ * actions demandées par les événements MiniLibX depuis le tick précédent
+ * (les actions sont remises à zéro), ainsi que le déplacement accumulé de la
+ * souris. C'est le seul point d'entrée des commandes du joueur dans la
+ * simulation: l'enregistrement y écrit les entrées du tick, et la relecture
+ * les y remplace par celles du fichier.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_input(t_Cub3d *cub)
+{
+	t_Simulation	*s;
+	int				in;
+
+	s = cub->sim;
+	in = atomic_fetch_and(&s->input, INPUT_HELD);
+	s->look_dx = atomic_exchange(&s->mouse_dx, 0);
+	if (cub->replay)
+		in = replay_tick(cub, in);
+	input_apply(cub->player, in);
+}
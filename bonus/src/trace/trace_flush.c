@@ -0,0 +1,122 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Écrit le tampon de la chronologie et le vide.
+ *
+ * @param fd Le descripteur du fichier JSON.
+ * @param buf Le tampon à écrire.
+ * @param len Longueur du tampon, remise à zéro.
+ */
+static void	trace_write(int fd, char *buf, int *len)
+{
+	ssize_t	done;
+	int		off;
+
+	off = 0;
+	while (off < *len)
+	{
+		done = write(fd, buf + off, *len - off);
+		if (done < 0 && errno != EINTR)
+			break ;
+		if (done > 0)
+			off += done;
+	}
+	*len = 0;
+}
+
+/**
+ * @brief Écrit un événement au format 'trace_event' dans le tampon.
+ *
+ * L'instant est donné en microsecondes depuis le démarrage de la
+ * chronologie, avec trois décimales. La précision de l'événement (fichier
+ * XPM) suit son nom, et le numéro de la frame est rangé dans 'args'.
+ *
+ * @param t Pointeur vers la chronologie.
+ * @param e L'événement à écrire.
+ * @param out Le tampon, d'au moins TRACE_LINE octets libres.
+ * @return Le nombre d'octets écrits, 0 pour une case encore vide.
+ */
+static int	trace_put(t_Trace *t, t_TraceEvent *e, char *out)
+{
+	char	*sep;
+	int		len;
+
+	if (!e->name)
+		return (0);
+	sep = " ";
+	if (!e->detail[0])
+		sep = "";
+	len = snprintf(out, TRACE_LINE, ",\n{\"name\":\"%s%s%s\",\"ph\":\"%c\","
+			"\"ts\":%lld.%03lld,\"pid\":%d,\"tid\":%d", e->name, sep,
+			e->detail, e->ph, e->ts / 1000, e->ts % 1000, t->pid, e->tid);
+	if (e->frame >= 0)
+		len += snprintf(out + len, TRACE_LINE - len,
+				",\"args\":{\"frame\":%lld}", e->frame);
+	out[len++] = '}';
+	return (len);
+}
+
+/**
+ * @brief Ouvre le fichier JSON et écrit le début de l'objet 'traceEvents'.
+ *
+ * Le premier événement, de type métadonnée ('M'), nomme le processus dans
+ * l'interface de Perfetto.
+ *
+ * @param t Pointeur vers la chronologie.
+ * @param buf Le tampon de la chronologie.
+ * @param len Reçoit la longueur écrite dans le tampon.
+ * @return Le descripteur du fichier, ou -1 en cas d'échec.
+ */
+static int	trace_open(t_Trace *t, char *buf, int *len)
+{
+	int	fd;
+
+	fd = open(t->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	*len = snprintf(buf, TRACE_BUF, "{\"traceEvents\":[\n{\"name\":"
+			"\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":"
+			"\"cub3D\"}}", t->pid);
+	return (fd);
+}
+
+/**
+ * @brief Écrit la chronologie dans son fichier JSON.
+ *
+ * Le fichier suit le format 'trace_event', lisible par chrome://tracing et
+ * ui.perfetto.dev: un événement de début ('B') et de fin ('E') par étape,
+ * avec le processus, le thread et la frame. Si l'anneau a débordé, seuls
+ * les TRACE_EVENTS derniers événements sont écrits; une fin sans début est
+ * ignorée par ces outils. Elle n'est appelée que depuis le thread
+ * principal, par 'trace_close' dans 'free_main', y compris après SIGINT ou
+ * SIGTERM ('trace_poll'): elle n'est pas async-signal-safe et ne doit pas
+ * être appelée depuis un gestionnaire de signal.
+ *
+ * @param t Pointeur vers la chronologie, ou NULL.
+ */
+void	trace_flush(t_Trace *t)
+{
+	char		buf[TRACE_BUF];
+	long long	head;
+	long long	i;
+	int			len;
+	int			fd;
+
+	if (!t)
+		return ;
+	fd = trace_open(t, buf, &len);
+	if (fd < 0)
+		return ;
+	head = atomic_load(&t->head);
+	i = 0;
+	if (head > TRACE_EVENTS)
+		i = head - TRACE_EVENTS;
+	while (i < head)
+	{
+		if (TRACE_BUF - len < TRACE_LINE)
+			trace_write(fd, buf, &len);
+		len += trace_put(t, &t->ring[i++ % TRACE_EVENTS], buf + len);
+	}
+	trace_write(fd, buf, &len);
+	len = snprintf(buf, TRACE_BUF, "\n],\"displayTimeUnit\":\"ms\"}\n");
+	trace_write(fd, buf, &len);
+	close(fd);
+}
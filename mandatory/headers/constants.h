@@ -3,12 +3,125 @@
 
 # define WINDOW_X 1920
 # define WINDOW_Y 1080
+# define WINDOW_MIN_X 800
+# define WINDOW_MIN_Y 600
+# define WINDOW_MAX_X 7680
+# define WINDOW_MAX_Y 4320
+
+# define SCALE_MIN 25
+# define SCALE_STEP 5
+# define SCALE_PERIOD 8
+# define SCALE_SMOOTH 8
+# define SCALE_HEADROOM 0.9
+# define VIEW_BLOCK 16
+# define SCALER_SLOTS 1024
+# define SCALER_BUCKETS 2048
 
 # ifndef BONUS
 #  define BONUS 0
 # endif
 
+# ifndef FIXED_POINT
+#  define FIXED_POINT 0
+# endif
+# define FIX_SHIFT 24
+# define FIX_ONE 16777216
+# define TEX_SHIFT 32
+# define FIX_DIST_MAX 274877906944LL
+
 # define SKIP 6
+# define MAT_FIRST '2'
+# define MAT_COUNT 7
+
+# define ATLAS_DOOR 4
+# define ATLAS_MAT 5
+# define ATLAS_SLOTS 12
+# define ATLAS_ALIGN 64
+# define PAL_SIZE 256
+# define CMAP_ROWS 4
+
+# define TARGET_FPS 60
+# define REF_FPS 60.0
+# define SPIN_NS 1000000
+# define MOVE_SPEED 0.2
+# define ROT_SPEED 0.1
+
+# define SIM_HZ 120
+# define SIM_MAX_TICKS 8
+# define SNAP_NEW 4
+# define SNAP_MASK 3
+# define GUN_ANIM_TICKS 2
+
+# define PROF_WINDOW 128
+# define PROF_REFRESH 30
+# define PROF_STAGES 12
+# define PROF_MOVE 0
+# define PROF_DOORS 1
+# define PROF_IMAGE 2
+# define PROF_MINIMAP 3
+# define PROF_FLOOR 4
+# define PROF_CAST 5
+# define PROF_TEXTURE 6
+# define PROF_TRANSPOSE 7
+# define PROF_UPSCALE 8
+# define PROF_HUD 9
+# define PROF_PRESENT 10
+# define PROF_FRAME 11
+
+# define STATS_HEAT_MAX 64
+
+# define PERF_EVENTS 6
+# define PERF_TASK 0
+# define PERF_CYCLES 1
+# define PERF_INSTR 2
+# define PERF_L1D 3
+# define PERF_LLC 4
+# define PERF_BRANCH 5
+
+# define BENCH_FRAMES 600
+# define BENCH_MAX_KEYS 1024
+
+# define INPUT_UP 1
+# define INPUT_DOWN 2
+# define INPUT_LEFT 4
+# define INPUT_RIGHT 8
+# define INPUT_L_KEY 16
+# define INPUT_R_KEY 32
+# define INPUT_HELD 63
+# define INPUT_USE 64
+# define INPUT_SHOOT 128
+# define INPUT_END 32768
+
+# define REPLAY_RECORD 1
+# define REPLAY_PLAY 2
+# define REPLAY_MAGIC 0x50523343
+# define REPLAY_VERSION 1
+# define FNV_OFFSET 14695981039346656037ULL
+# define FNV_PRIME 1099511628211ULL
+
+# define CAPTURE_SLOTS 4
+
+# define TRACE_EVENTS 65536
+# define TRACE_DETAIL 40
+# define TRACE_BUF 16384
+# define TRACE_LINE 256
+
+# define GOLDEN_POSES 4
+# define GOLDEN_SCALE 8
+# define GOLDEN_W 240
+# define GOLDEN_H 135
+# define GOLDEN_TOL 8
+# if FIXED_POINT
+#  define GOLDEN_MAX_PERMILLE 15
+# else
+#  define GOLDEN_MAX_PERMILLE 5
+# endif
+
+# define MINIMAP_POS 30
+
+# define FONT_SCALE 2
+# define FONT_GLYPHS 42
+# define FONT_CHARSET "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ.:-/%_"
 
 # define WHITE 0xFFFFFF
 # define GREY 0x808080
@@ -24,6 +137,8 @@
 # define R_ARROW 65363
 # define USE 101
 # define ESC 65307
+# define F3 65472
+# define F4 65473
 
 # define DOOR_RANGE_X 10
 # define DOOR_RANGE_Y 10
@@ -11,23 +11,50 @@
 # include <sys/wait.h>
 # include <sys/types.h>
 # include <sys/time.h>
+# include <time.h>
+# include <pthread.h>
+# include <stdatomic.h>
 # include <stdlib.h>
 # include <fcntl.h>
+# include <limits.h>
+# include <semaphore.h>
+# include <string.h>
+# include <errno.h>
+# include <signal.h>
+# include <sys/syscall.h>
+# include <linux/perf_event.h>
 
 /**
  * @struct t_WindowConfig
  * Structure de configuration des propriétés de la fenêtre dans le projet Cub3D.
- * Il définit les dimensions et les proportions de la fenêtre de rendu du jeu.
+ * Il définit les dimensions de la fenêtre et la résolution interne de la vue
+ * 3D, qui peut être plus petite puis agrandie à la taille de la fenêtre.
  *
- * @param WindowSizeX Largeur de la fenêtre de rendu en pixels.
- * @param WindowSizeY Hauteur de la fenêtre de rendu en pixels.
- * @param WindowAspectRatio hauteur / largeur de la fenêtre.
+ * @param width Largeur de la fenêtre et de l'image du jeu en pixels.
+ * @param height Hauteur de la fenêtre et de l'image du jeu en pixels.
+ * @param render_w Largeur de la vue 3D en pixels.
+ * @param render_h Hauteur de la vue 3D en pixels.
+ * @param scale Résolution de la vue 3D, en pourcentage de la fenêtre.
+ * @param budget_ns Durée de frame visée par la résolution dynamique (ns), 0
+ * pour une résolution fixe.
+ * @param avg_ns Moyenne glissante de la durée des dernières frames (ns).
+ * @param frames Nombre de frames depuis le dernier changement de résolution.
+ * @param resize_w Largeur demandée par le gestionnaire de fenêtres, 0 si
+ * aucune.
+ * @param resize_h Hauteur demandée par le gestionnaire de fenêtres.
  */
 typedef struct s_WindowConfig
 {
-	int	width;
-	int	height;
-	int	aspect_ratio;
+	int			width;
+	int			height;
+	int			render_w;
+	int			render_h;
+	int			scale;
+	long long	budget_ns;
+	double		avg_ns;
+	int			frames;
+	int			resize_w;
+	int			resize_h;
 }				t_WindowConfig;
 
 /**
@@ -45,6 +72,8 @@ typedef struct s_WindowConfig
  * @param endian  L'ordre des octets dans les données d'image (endianess).
  * @param width  Largeur de l'image en pixels.
  * @param height Hauteur de l'image en pixels.
+ * @param writes Nombre de pixels écrits par 'my_mlx_pixel_put' depuis la
+ * dernière remise à zéro.
  */
 typedef struct s_ImageControl
 {
@@ -53,8 +82,9 @@ typedef struct s_ImageControl
 	int		bpp;
 	int		len;
 	int		endian;
-	int		width;
-	int		height;
+	int			width;
+	int			height;
+	long long	writes;
 }				t_ImageControl;
 
 /**
@@ -91,6 +121,10 @@ typedef struct s_TextureSetup
  * @param l_key État de la touche gauche ou de l'action.
  * @param r_key État de la touche droite ou de l'action.
  * @param shoot shoot indiquant si le joueur est en train de tirer.
+ * @param use Flag indiquant qu'une action d'utilisation attend le prochain tick.
+ * @param gun_frame Image courante de l'animation de tir (0 au repos).
+ * @param gun_ticks Nombre de ticks écoulés sur l'image courante du tir.
+ * @param gun_shown Image du pistolet actuellement chargée par le rendu.
  * @param use_distance_y Y-coordonnée pour l'utilisation ou l'interaction avec les objets.
  * @param use_distance_x X-coordonnée pour l'utilisation ou l'interaction avec les objets.
  * @param crosshair Pointeur vers la configuration de la texture du réticule.
@@ -110,6 +144,10 @@ typedef struct s_PlayerConfig
 	int				l_key;
 	int				r_key;
 	int				shoot;
+	int				use;
+	int				gun_frame;
+	int				gun_ticks;
+	int				gun_shown;
 	float			use_distance_y;
 	float			use_distance_x;
 	t_TextureSetup	*crosshair;
@@ -144,6 +182,19 @@ typedef struct s_MiniMap
 	int				flag;
 }				t_MiniMap;
 
+/**
+ * @struct t_Door
+ * Position d'une tuile de porte ('9') dans la matrice de la carte.
+ *
+ * @param x L'index de la colonne de la porte.
+ * @param y L'index de ligne de la porte.
+ */
+typedef struct s_Door
+{
+	int	x;
+	int	y;
+}				t_Door;
+
 /**
  * @struct t_MapConfig
  * Structure de gestion de la configuration de la carte dans le jeu Cub3D.
@@ -158,6 +209,9 @@ typedef struct s_MiniMap
  * @param max_line_len Longueur maximale d'une ligne sur la carte.
  * @param skip_counter Un compteur utilisé pour analyser la carte.
  * @param matrix Représentation matricielle de la carte.
+ * @param world Matrice sur laquelle joue la simulation (collisions, portes):
+ * 'matrix' elle-même en mono-thread, une copie propre au thread de
+ * simulation avec '--sim-thread'.
  * @param up_valid Flag indiquant si "up" est valide dans une position donnée.
  * @param down_valid Flag indiquant si le "down" est valide dans une position donnée.
  * @param left_valid Flag indiquant si le "left" est valide dans une position donnée.
@@ -171,7 +225,12 @@ typedef struct s_MiniMap
  * @param tex_east  Configuration de texture pour le mur orienté au est.
  * @param tex_west  Configuration de texture pour le mur orienté au ouest.
  * @param tex_door Configuration de texture pour les portes (si disponible, pour bonus).
- * @param door_pos Positions des portes sur la carte (si disponible, pour le bonus).
+ * @param tex_mat Texture de chaque matériau de mur ('2' à '8'), déclarée par
+ * une ligne 'M2' à 'M8' de l'en-tête, ou NULL.
+ * @param doors Table des positions des portes sur la carte (pour le bonus).
+ * @param n_doors Nombre de portes dans la table 'doors'.
+ * @param door_changes Nombre de portes ouvertes ou refermées depuis le début
+ * de la partie.
  */
 typedef struct s_MapConfig
 {
@@ -181,6 +240,7 @@ typedef struct s_MapConfig
 	int				max_line_len;
 	int				skip_counter;
 	char			**matrix;
+	char			**world;
 	int				up_valid;
 	int				down_valid;
 	int				left_valid;
@@ -194,7 +254,10 @@ typedef struct s_MapConfig
 	t_TextureSetup	*tex_east;
 	t_TextureSetup	*tex_west;
 	t_TextureSetup	*tex_door;
-	char			**door_pos;
+	t_TextureSetup	*tex_mat[MAT_COUNT];
+	t_Door			*doors;
+	int				n_doors;
+	int				door_changes;
 }				t_MapConfig;
 
 /**
@@ -215,6 +278,94 @@ typedef struct s_Transform
 	double	z;
 }				t_Transform;
 
+/**
+ * @struct t_RayHit
+ * Résultat du lancer de rayon d'une colonne de l'écran.
+ *
+ * La passe de lancer ('cast_rays') remplit une entrée par colonne; la passe
+ * de texture ('texture_rays') les relit ensuite.
+ *
+ * @param raydir_x Cordonnée X de la direction du rayon.
+ * @param raydir_y Cordonnée Y de la direction du rayon.
+ * @param perp_wd Distance perpendiculaire du mur touché.
+ * @param map_x Cordonnée X de la cellule touchée.
+ * @param map_y Cordonnée Y de la cellule touchée.
+ * @param side Côté du mur touché (0 pour vertical, 1 pour horizontal).
+ * @param line_height Hauteur de la colonne de mur à dessiner.
+ * @param draw_start Pixel de départ de la colonne de mur.
+ * @param draw_end Pixel de fin de la colonne de mur.
+ * @param wall_dir Direction du mur touché.
+ * @param steps Nombre de pas du DDA avant l'impact.
+ * @param wall_fx Point d'impact sur le mur, de 0 à 1, en virgule fixe
+ * (moteur FIXED_POINT).
+ * @param wall_tex Texture du mur touché dans l'atlas des textures.
+ */
+typedef struct s_RayHit
+{
+	double	raydir_x;
+	double	raydir_y;
+	double	perp_wd;
+	int		map_x;
+	int		map_y;
+	int		side;
+	int		line_height;
+	int		draw_start;
+	int		draw_end;
+	int		wall_dir;
+	int		steps;
+	int		wall_fx;
+	int		wall_tex;
+}				t_RayHit;
+
+/**
+ * @struct t_FixRay
+ * Rayon d'une colonne de l'écran en virgule fixe, pour le moteur
+ * FIXED_POINT.
+ *
+ * Les valeurs sont des entiers 64 bits à FIX_SHIFT bits de fraction: les
+ * distances delta des rayons presque parallèles à un axe sont bornées à
+ * FIX_DIST_MAX, et leurs produits par une fraction ou une direction
+ * restent sans débordement.
+ *
+ * @param raydir_x Cordonnée X de la direction du rayon.
+ * @param raydir_y Cordonnée Y de la direction du rayon.
+ * @param ddist_x Distance entre deux limites de cellule en X le long du rayon.
+ * @param ddist_y Distance entre deux limites de cellule en Y le long du rayon.
+ * @param s_dist_x Distance jusqu'à la prochaine limite de cellule en X.
+ * @param s_dist_y Distance jusqu'à la prochaine limite de cellule en Y.
+ * @param perp_wd Distance perpendiculaire du mur touché.
+ */
+typedef struct s_FixRay
+{
+	long long	raydir_x;
+	long long	raydir_y;
+	long long	ddist_x;
+	long long	ddist_y;
+	long long	s_dist_x;
+	long long	s_dist_y;
+	long long	perp_wd;
+}				t_FixRay;
+
+/**
+ * @struct t_RayDir
+ * Direction du rayon d'une colonne de l'écran, qui ne dépend que de la
+ * direction et du plan de la caméra.
+ *
+ * @param raydir_x Cordonnée X de la direction du rayon.
+ * @param raydir_y Cordonnée Y de la direction du rayon.
+ * @param ddist_x Distance entre deux limites de cellule en X le long du rayon.
+ * @param ddist_y Distance entre deux limites de cellule en Y le long du rayon.
+ * @param fx La direction et les distances delta en virgule fixe.
+ */
+typedef struct s_RayDir
+{
+	double		raydir_x;
+	double		raydir_y;
+	double		ddist_x;
+	double		ddist_y;
+	t_FixRay	fx;
+}				t_RayDir;
+
 /**
  * @struct t_CameraConfig
  * Structure de gestion de la configuration de la caméra dans le projet Cub3D.
@@ -243,6 +394,9 @@ typedef struct s_Transform
  * @param step_x Valeur de pas pour la coordonnée X dans le lancer de rayons.
  * @param step_y Valeur de pas pour la coordonnée Y dans le lancer de rayons.
  * @param hit Flag indiquant si un mur a été touché.
+ * @param steps Nombre de pas du DDA du rayon courant.
+ * @param width Largeur de la vue 3D en pixels.
+ * @param height Hauteur de la vue 3D en pixels.
  * @param side Flag indiquant de quel côté du mur a été touché (0 pour vertical, 1
  * pour horizontal).
  * @param line_height Hauteur de la ligne de mur à dessiner.
@@ -259,6 +413,19 @@ typedef struct s_Transform
  * @param tex" Tableau bidimensionnel représentant les textures des murs.
  * @param tex_vector Flag indiquant si des textures sont utilisées.
  * @param color Valeur de couleur pour le rendu.
+ * @param hits Table des impacts de rayon, une entrée par colonne de l'écran.
+ * @param rays Table des directions des rayons, une entrée par colonne de
+ * l'écran.
+ * @param rays_dir Direction de la caméra avec laquelle 'rays' a été calculée.
+ * @param rays_plane Plan de la caméra avec lequel 'rays' a été calculée.
+ * @param rays_w Largeur de la vue 3D pour laquelle 'rays' a été calculée, 0
+ * si la table est à recalculer.
+ * @param fx Le rayon courant en virgule fixe (moteur FIXED_POINT).
+ * @param fpos_x Cordonnée X de la caméra en virgule fixe.
+ * @param fpos_y Cordonnée Y de la caméra en virgule fixe.
+ * @param wall_fx Point d'impact sur le mur en virgule fixe.
+ * @param wall_tex Texture du mur touché dans l'atlas des textures: face
+ * touchée d'un mur '1', porte ou matériau de la cellule.
  */
 typedef struct s_CameraConfig
 {
@@ -281,6 +448,9 @@ typedef struct s_CameraConfig
 	int				step_x;
 	int				step_y;
 	int				hit;
+	int				steps;
+	int				width;
+	int				height;
 	int				side;
 	int				line_height;
 	int				draw_start;
@@ -296,8 +466,208 @@ typedef struct s_CameraConfig
 	int				**tex;
 	bool			tex_vector;
 	unsigned int	color;
+	t_RayHit		*hits;
+	t_RayDir		*rays;
+	t_Transform		rays_dir;
+	t_Transform		rays_plane;
+	int				rays_w;
+	t_FixRay		fx;
+	long long		fpos_x;
+	long long		fpos_y;
+	int				wall_fx;
+	int				wall_tex;
 }				t_CameraConfig;
 
+/**
+ * @struct t_Scaler
+ * Table des lignes de texture lues par une colonne de mur d'une hauteur
+ * donnée.
+ *
+ * La ligne de texture de chaque pixel d'une colonne ne dépend que de la
+ * hauteur du mur à l'écran, de celle de la vue 3D et des dimensions de la
+ * texture: c'est la clé de la table.
+ *
+ * @param rows Ligne de texture de chaque pixel de la colonne, de haut en bas.
+ * @param cap Nombre d'entrées allouées dans 'rows'.
+ * @param len Nombre de pixels de la colonne.
+ * @param lh Hauteur du mur à l'écran (clé).
+ * @param height Hauteur de la vue 3D (clé).
+ * @param tex_w Largeur de la texture (clé).
+ * @param tex_h Hauteur de la texture (clé).
+ * @param hash Seau de la table dans le cache.
+ * @param next Table suivante du même seau, ou -1.
+ * @param used Horloge du cache au dernier usage de la table.
+ */
+typedef struct s_Scaler
+{
+	unsigned short	*rows;
+	int				cap;
+	int				len;
+	int				lh;
+	int				height;
+	int				tex_w;
+	int				tex_h;
+	int				hash;
+	int				next;
+	long long		used;
+}				t_Scaler;
+
+/**
+ * @struct t_ScalerCache
+ * Cache des tables de lignes de texture, borné à SCALER_SLOTS tables.
+ *
+ * Les tables sont retrouvées par un hachage de leur clé sur SCALER_BUCKETS
+ * seaux chaînés. Quand le cache est plein, la table utilisée le moins
+ * récemment est remplacée.
+ *
+ * @param slots Les tables.
+ * @param bucket Première table de chaque seau, ou -1.
+ * @param count Nombre de tables utilisées.
+ * @param clock Horloge du cache, avancée à chaque usage d'une table.
+ * @param hits Nombre de colonnes servies par une table existante.
+ * @param misses Nombre de tables construites.
+ * @param evictions Nombre de tables remplacées.
+ * @param frame_hits Colonnes servies depuis les derniers compteurs du rendu.
+ * @param frame_misses Tables construites depuis les derniers compteurs.
+ * @param bytes Mémoire allouée aux tables, en octets.
+ */
+typedef struct s_ScalerCache
+{
+	t_Scaler	slots[SCALER_SLOTS];
+	int			bucket[SCALER_BUCKETS];
+	int			count;
+	long long	clock;
+	long long	hits;
+	long long	misses;
+	long long	evictions;
+	long long	frame_hits;
+	long long	frame_misses;
+	long long	bytes;
+}				t_ScalerCache;
+
+/**
+ * @struct t_Palette
+ * Palette des textures indexées ('--indexed') et ses tables d'ombrage.
+ *
+ * Comme la COLORMAP de Doom, chaque ligne de 'cmap' donne la couleur déjà
+ * ombrée de chaque index de la palette: l'ombrage d'un texel n'est plus
+ * qu'une lecture dans la ligne de la face touchée.
+ *
+ * @param color Les couleurs de la palette.
+ * @param cmap Une ligne par face (nord et portes, sud, ouest, est), avec
+ * l'ombrage de 'apply_shader'.
+ * @param count Nombre de couleurs utilisées.
+ */
+typedef struct s_Palette
+{
+	unsigned int	color[PAL_SIZE];
+	unsigned int	cmap[CMAP_ROWS][PAL_SIZE];
+	int				count;
+}				t_Palette;
+
+/**
+ * @struct t_PalCut
+ * Découpage médian des texels en boîtes de couleurs.
+ *
+ * Chaque élément de 'e' porte la couleur d'un texel (bits 32 à 55) et sa
+ * position dans l'atlas (bits 0 à 31). Une boîte est une tranche de 'e'.
+ *
+ * @param e Les texels à répartir.
+ * @param tmp Tampon de même taille que 'e', pour le tri.
+ * @param start Premier élément de chaque boîte.
+ * @param count Nombre d'éléments de chaque boîte.
+ * @param chan Composante la plus étendue de chaque boîte (0 rouge, 1 vert,
+ * 2 bleu).
+ * @param range Étendue de cette composante, 0 pour une seule couleur.
+ * @param boxes Nombre de boîtes.
+ */
+typedef struct s_PalCut
+{
+	unsigned long long	*e;
+	unsigned long long	*tmp;
+	int					start[PAL_SIZE];
+	int					count[PAL_SIZE];
+	int					chan[PAL_SIZE];
+	int					range[PAL_SIZE];
+	int					boxes;
+}				t_PalCut;
+
+/**
+ * @struct t_Atlas
+ * Atlas des textures des murs, des portes et des matériaux.
+ *
+ * Toutes les textures sont recopiées au chargement dans un seul bloc de
+ * mémoire, chacune alignée sur ATLAS_ALIGN octets et rangée ligne après
+ * ligne sans remplissage. Chaque entrée décrit une texture de l'atlas:
+ * faces nord, sud, ouest et est (0 à 3), porte (ATLAS_DOOR), puis matériaux
+ * '2' à '8' (à partir de ATLAS_MAT).
+ *
+ * Avec '--indexed', l'atlas ne garde qu'un octet par texel, l'index de sa
+ * couleur dans la palette; les entrées décrivent alors les images de
+ * MiniLibX, lues par les calculs par pixel.
+ *
+ * @param base Le bloc alloué, dont l'atlas est la partie alignée.
+ * @param tex Les textures de l'atlas; une entrée absente a une adresse
+ * NULL.
+ * @param index Les textures indexées de l'atlas, une ligne de 'width'
+ * octets après l'autre, ou NULL hors de '--indexed'.
+ * @param bytes Taille de l'atlas, en octets.
+ * @param pal La palette des textures indexées, ou NULL.
+ * @param reads Nombre de texels lus dans l'atlas par la passe de texture,
+ * remis à zéro par 'stats_rays'.
+ */
+typedef struct s_Atlas
+{
+	char			*base;
+	t_ImageControl	tex[ATLAS_SLOTS];
+	unsigned char	*index[ATLAS_SLOTS];
+	long long		bytes;
+	t_Palette		*pal;
+	long long		reads;
+}				t_Atlas;
+
+/**
+ * @struct t_Column
+ * Arguments des noyaux spécialisés qui dessinent une colonne de mur.
+ *
+ * Les adresses sont déjà résolues pour des pixels de 32 bits: le noyau ne
+ * fait plus que lire les texels de la colonne de texture et les écrire dans
+ * la cible, un pixel de mur après l'autre.
+ *
+ * @param dst Premier pixel écrit dans la cible (image du jeu ou tampon par
+ * colonnes).
+ * @param pitch Écart entre deux pixels successifs de la colonne dans la
+ * cible, en pixels.
+ * @param src Premier texel de la colonne de texture lue.
+ * @param tex_pitch Écart entre deux lignes de la texture, en pixels.
+ * @param rows Table des lignes de texture de la colonne, ou NULL si les
+ * lignes sont calculées pas à pas.
+ * @param count Nombre de pixels de la colonne.
+ * @param step Avance dans la texture par pixel, sans table.
+ * @param pos Position de départ dans la texture, sans table.
+ * @param wrap Nombre de lignes de texture parcourues avant de reboucler.
+ * @param shade Facteur d'ombrage de la face, 0 si la face n'est pas ombrée.
+ * @param isrc Premier texel de la colonne de la texture indexée, ou NULL.
+ * @param cmap Ligne de la table d'ombrage de la face, avec 'isrc'.
+ */
+typedef struct s_Column
+{
+	unsigned int	*dst;
+	int				pitch;
+	unsigned int	*src;
+	int				tex_pitch;
+	unsigned short	*rows;
+	int				count;
+	float			step;
+	float			pos;
+	int				wrap;
+	float			shade;
+	unsigned char	*isrc;
+	unsigned int	*cmap;
+}				t_Column;
+
+typedef void	(*t_ColumnFn)(t_Column *k);
+
 /**
 * @struct  t_Menu
 * Structure de gestion du menu du jeu dans le projet Cub3D.
@@ -315,6 +685,539 @@ typedef struct s_Menu
 	t_TextureSetup	*quit;
 }				t_Menu;
 
+/**
+ * @struct t_Options
+ * Structure regroupant les options de la ligne de commande de Cub3D.
+ *
+ * @param map_file Chemin du fichier de carte '.cub' à charger.
+ * @param target_fps Nombre de frames par seconde visé (0 pour illimité).
+ * @param tick_rate Fréquence de la simulation en ticks par seconde.
+ * @param sim_thread true pour exécuter la simulation sur son propre thread.
+ * @param sync_policy Politique de synchronisation X de la boucle MiniLibX.
+ * @param sync_every Nombre de frames entre deux XSync (MLX_SYNC_EVERY).
+ * @param profile_out Fichier CSV recevant les mesures de chaque frame.
+ * @param perf true pour lire les compteurs matériels du processeur autour de
+ * chaque étape de la frame.
+ * @param trace Fichier JSON recevant la chronologie des frames, ou NULL.
+ * @param heatmap true pour démarrer avec la carte de chaleur des pas du DDA.
+ * @param width Largeur de la fenêtre ('--size'), 0 pour WINDOW_X.
+ * @param height Hauteur de la fenêtre ('--size'), 0 pour WINDOW_Y.
+ * @param scale Résolution de la vue 3D en pourcentage ('--scale'), 0 pour
+ * la pleine résolution.
+ * @param frame_budget Durée de frame visée par la résolution dynamique en
+ * millisecondes ('--frame-budget'), 0 pour une résolution fixe.
+ * @param column_major true pour rendre la vue 3D dans un tampon rangé par
+ * colonnes ('--column-major'), transposé dans l'image du jeu avant
+ * l'affichage.
+ * @param indexed true pour texturer les murs depuis des textures indexées
+ * sur une palette de 256 couleurs ('--indexed').
+ * @param bench true pour lancer le banc d'essai sans fenêtre.
+ * @param bench_path Fichier du trajet de caméra du banc d'essai, ou NULL.
+ * @param bench_frames Nombre de frames rendues par le banc d'essai.
+ * @param record Fichier recevant les entrées de la partie, ou NULL.
+ * @param replay Fichier d'entrées à rejouer à la place du clavier, ou NULL.
+ * @param replay_fast true pour rejouer sans attendre l'échéance des frames.
+ * @param headless true pour rejouer sans serveur X (backend nul).
+ * @param capture Flux Y4M ('.y4m') ou préfixe des fichiers PPM recevant les
+ * frames capturées, ou NULL.
+ * @param golden Dossier des images de référence du banc d'essai, ou NULL.
+ * @param golden_update true pour réécrire les images de référence.
+ */
+typedef struct s_Options
+{
+	char	*map_file;
+	int		target_fps;
+	int		tick_rate;
+	bool	sim_thread;
+	int		sync_policy;
+	int		sync_every;
+	char	*profile_out;
+	bool	perf;
+	char	*trace;
+	bool	heatmap;
+	int		width;
+	int		height;
+	int		scale;
+	int		frame_budget;
+	bool	column_major;
+	bool	indexed;
+	bool	bench;
+	char	*bench_path;
+	int		bench_frames;
+	char	*record;
+	char	*replay;
+	bool	replay_fast;
+	bool	headless;
+	char	*capture;
+	char	*golden;
+	bool	golden_update;
+}				t_Options;
+
+/**
+ * @struct t_FrameClock
+ * Structure de cadencement des frames de la boucle de jeu.
+ *
+ * Elle limite la consommation CPU à un nombre de FPS cible et mesure la
+ * durée de chaque frame. Les mouvements ne dépendent pas de cette horloge
+ * mais des ticks fixes de la simulation ('t_Simulation').
+ *
+ * @param target_ns Durée cible d'une frame en nanosecondes (0 = illimité).
+ * @param frame_start Instant de début de la frame courante (ns).
+ * @param deadline Instant auquel la frame suivante doit commencer (ns).
+ * @param frame_time Durée mesurée de la dernière frame, en secondes.
+ * @param avg_frame_time Moyenne glissante de la durée des frames, en secondes.
+ */
+typedef struct s_FrameClock
+{
+	long long	target_ns;
+	long long	frame_start;
+	long long	deadline;
+	double		frame_time;
+	double		avg_frame_time;
+}				t_FrameClock;
+
+/**
+ * @struct t_SimState
+ * Instantané de l'état de la simulation nécessaire au rendu.
+ *
+ * @param pos_x Coordonnée X de la position du joueur.
+ * @param pos_y Coordonnée Y de la position du joueur.
+ * @param dir_x X-composante du vecteur de direction du joueur.
+ * @param dir_y Y-composante du vecteur de direction du joueur.
+ * @param plane_x Cordonnée X du plan de vue de la caméra.
+ * @param plane_y Cordonnée Y du plan de vue de la caméra.
+ * @param gun_frame Image courante de l'animation du pistolet.
+ * @param doors Nombre de changements de porte ('door_changes') à l'instant
+ * de la capture.
+ * @param time_ns Instant de capture de l'état (ns).
+ */
+typedef struct s_SimState
+{
+	double		pos_x;
+	double		pos_y;
+	double		dir_x;
+	double		dir_y;
+	double		plane_x;
+	double		plane_y;
+	int			gun_frame;
+	int			doors;
+	long long	time_ns;
+}				t_SimState;
+
+/**
+ * @struct t_SimPair
+ * Les deux derniers états publiés par le thread de simulation.
+ *
+ * @param prev L'avant-dernier état.
+ * @param cur Le dernier état.
+ */
+typedef struct s_SimPair
+{
+	t_SimState	prev;
+	t_SimState	cur;
+}				t_SimPair;
+
+/**
+ * @struct t_Simulation
+ * Structure de la simulation à pas fixe, découplée du rendu.
+ *
+ * La simulation avance par ticks de durée constante; le rendu interpole la
+ * pose du joueur entre les deux derniers ticks. En mode multi-thread, les
+ * états sont publiés dans un triple tampon ('slots') sans verrou: le thread
+ * de simulation écrit dans 'back', le rendu lit 'front', et 'middle' est
+ * échangé atomiquement entre les deux.
+ *
+ * @param tick_ns Durée d'un tick en nanosecondes.
+ * @param step_scale Facteur de vitesse d'un tick (1.0 pour 1/REF_FPS s).
+ * @param rot_cos Cosinus de l'angle de rotation d'un tick au clavier.
+ * @param rot_sin Sinus de l'angle de rotation d'un tick au clavier.
+ * @param acc Temps accumulé pas encore simulé (ns), en mode mono-thread.
+ * @param last_ns Instant de la dernière mise à jour de l'accumulateur (ns).
+ * @param ticks Nombre de ticks exécutés depuis le démarrage.
+ * @param alpha Coefficient d'interpolation entre 'prev' et 'cur'.
+ * @param prev L'avant-dernier état de la simulation.
+ * @param cur Le dernier état de la simulation.
+ * @param view La pose interpolée lue par le rendu.
+ * @param slots Les trois tampons de publication des états.
+ * @param doors État des portes ('0' ou '9') publié avec chaque tampon de
+ * 'slots', dans l'ordre de la table des portes.
+ * @param back Tampon en cours d'écriture par le thread de simulation.
+ * @param front Tampon en cours de lecture par le rendu.
+ * @param middle Tampon échangé, marqué SNAP_NEW s'il n'a pas encore été lu.
+ * @param running Flag d'exécution du thread de simulation.
+ * @param thread Le thread de simulation.
+ * @param threaded true si la simulation tourne sur son propre thread.
+ * @param mouse_dx Déplacement horizontal de la souris pas encore consommé.
+ * @param input Touches enfoncées et actions demandées pas encore consommées
+ * (INPUT_*), écrites par les événements MiniLibX.
+ * @param look_dx Déplacement de la souris appliqué par le tick courant.
+ */
+typedef struct s_Simulation
+{
+	long long		tick_ns;
+	double			step_scale;
+	double			rot_cos;
+	double			rot_sin;
+	long long		acc;
+	long long		last_ns;
+	long long		ticks;
+	double			alpha;
+	t_SimState		prev;
+	t_SimState		cur;
+	t_SimState		view;
+	t_SimPair		slots[3];
+	char			*doors[3];
+	int				back;
+	int				front;
+	_Atomic int		middle;
+	_Atomic int		running;
+	pthread_t		thread;
+	bool			threaded;
+	_Atomic int		mouse_dx;
+	_Atomic int		input;
+	int				look_dx;
+}				t_Simulation;
+
+/**
+ * @struct t_ProfStage
+ * Mesures d'une étape de la frame dans le profileur.
+ *
+ * @param start Instant d'ouverture de la mesure en cours (ns).
+ * @param cur Durée cumulée de l'étape dans la frame courante (ns).
+ * @param ring Durées des PROF_WINDOW dernières frames (ns).
+ * @param min Durée minimale sur la fenêtre, en millisecondes.
+ * @param avg Durée moyenne sur la fenêtre, en millisecondes.
+ * @param p99 99e centile de la durée sur la fenêtre, en millisecondes.
+ */
+typedef struct s_ProfStage
+{
+	long long	start;
+	long long	cur;
+	long long	ring[PROF_WINDOW];
+	double		min;
+	double		avg;
+	double		p99;
+}				t_ProfStage;
+
+/**
+ * @struct t_Perf
+ * Compteurs matériels du profileur, lus avec 'perf_event_open'.
+ *
+ * Les compteurs forment un groupe mené par le temps CPU du thread
+ * ('task-clock'): ils sont lus ensemble en un seul appel système. Un compteur
+ * que le processeur ou le noyau ne fournit pas est simplement absent.
+ *
+ * @param fd Descripteur de chaque compteur (PERF_*), ou -1 s'il est absent.
+ * @param slot Position de chaque compteur dans la lecture du groupe, ou -1.
+ * @param start Valeurs des compteurs à l'ouverture de chaque étape.
+ * @param cur Compteurs cumulés de chaque étape dans la frame courante.
+ * @param sum Compteurs cumulés depuis le dernier rafraîchissement.
+ * @param last Compteurs cumulés sur les PROF_REFRESH dernières frames,
+ * affichés par l'overlay.
+ * @param frames Nombre de frames cumulées dans 'sum'.
+ */
+typedef struct s_Perf
+{
+	int			fd[PERF_EVENTS];
+	int			slot[PERF_EVENTS];
+	long long	start[PROF_STAGES][PERF_EVENTS];
+	long long	cur[PROF_STAGES][PERF_EVENTS];
+	long long	sum[PROF_STAGES][PERF_EVENTS];
+	long long	last[PROF_STAGES][PERF_EVENTS];
+	int			frames;
+}				t_Perf;
+
+/**
+ * @struct t_TraceEvent
+ * Événement de début ou de fin de la chronologie '--trace'.
+ *
+ * @param name Nom de l'événement, une chaîne constante.
+ * @param detail Précision copiée avec l'événement (fichier XPM chargé), ou
+ * chaîne vide.
+ * @param ts Instant de l'événement (ns).
+ * @param frame Numéro de la frame en cours, ou -1 au démarrage.
+ * @param tid Identifiant système du thread.
+ * @param ph 'B' pour un début, 'E' pour une fin.
+ */
+typedef struct s_TraceEvent
+{
+	const char	*name;
+	char		detail[TRACE_DETAIL];
+	long long	ts;
+	long long	frame;
+	int			tid;
+	char		ph;
+}				t_TraceEvent;
+
+/**
+ * @struct t_Trace
+ * Chronologie des frames au format 'trace_event' de Chrome et Perfetto.
+ *
+ * Les événements sont rangés dans un anneau de TRACE_EVENTS cases alloué au
+ * démarrage: chaque thread réserve sa case avec un compteur atomique, sans
+ * verrou ni allocation. Seuls les TRACE_EVENTS derniers événements sont
+ * gardés. L'anneau est écrit sur le disque à la fin du programme, ou à la
+ * frame qui suit la réception de SIGINT ou SIGTERM ('trace_poll').
+ *
+ * @param ring Les TRACE_EVENTS cases de l'anneau.
+ * @param head Nombre d'événements enregistrés depuis le démarrage.
+ * @param frame Numéro de la frame en cours, ou -1 au démarrage.
+ * @param path Le fichier JSON de sortie ('--trace').
+ * @param t0 Instant du démarrage de la chronologie (ns).
+ * @param pid Identifiant du processus.
+ * @param stop Drapeau levé par le gestionnaire de SIGINT et SIGTERM: le
+ * numéro du signal reçu, ou 0.
+ */
+typedef struct s_Trace
+{
+	t_TraceEvent			*ring;
+	_Atomic long long		head;
+	_Atomic long long		frame;
+	char					*path;
+	long long				t0;
+	int						pid;
+	volatile sig_atomic_t	*stop;
+}							t_Trace;
+
+/**
+ * @struct t_RenderStats
+ * Compteurs du rendu d'une frame, affichés par l'overlay du profileur.
+ *
+ * @param steps Nombre total de pas du DDA.
+ * @param max_steps Plus grand nombre de pas du DDA d'une colonne.
+ * @param wall_px Nombre de pixels de mur écrits par la passe de texture.
+ * @param texels Nombre de texels lus par la passe de texture.
+ * @param writes Nombre de pixels écrits dans l'image du jeu.
+ * @param overdraw Nombre d'écritures en trop: le sol et le plafond couvrent
+ * déjà toute la vue 3D, chaque écriture suivante en remplace une autre.
+ * @param doors Nombre de colonnes dont le rayon touche une porte.
+ * @param columns Nombre de colonnes de la vue 3D.
+ * @param pixels Nombre de pixels de la vue 3D.
+ * @param scaler_hits Colonnes de mur servies par une table de lignes de
+ * texture existante.
+ * @param scaler_misses Tables de lignes de texture construites.
+ * @param scaler_bytes Mémoire des tables de lignes de texture, en octets.
+ */
+typedef struct s_RenderStats
+{
+	long long	steps;
+	int			max_steps;
+	long long	wall_px;
+	long long	texels;
+	long long	writes;
+	long long	overdraw;
+	int			doors;
+	int			columns;
+	long long	pixels;
+	long long	scaler_hits;
+	long long	scaler_misses;
+	long long	scaler_bytes;
+}				t_RenderStats;
+
+/**
+ * @struct t_Profiler
+ * Profileur des étapes de la boucle de jeu.
+ *
+ * @param stage Les mesures de chaque étape (PROF_*).
+ * @param head Index de la prochaine frame dans les fenêtres glissantes.
+ * @param count Nombre de frames présentes dans les fenêtres glissantes.
+ * @param frames Nombre de frames mesurées depuis le démarrage.
+ * @param overlay true si l'overlay est affiché (touche F3).
+ * @param csv Fichier de sortie CSV, ou NULL.
+ * @param owner Le thread principal, seul à effectuer des mesures.
+ * @param perf Les compteurs matériels, ou NULL sans l'option '--perf'.
+ * @param trace La chronologie des frames, ou NULL sans l'option '--trace'.
+ * @param rs Les compteurs du rendu de la frame courante.
+ * @param last Les compteurs du rendu de la dernière frame terminée.
+ * @param heatmap true pour remplacer la vue par la carte de chaleur des pas
+ * du DDA (touche F4 ou option '--heatmap').
+ */
+typedef struct s_Profiler
+{
+	t_ProfStage		stage[PROF_STAGES];
+	int				head;
+	int				count;
+	long long		frames;
+	bool			overlay;
+	FILE			*csv;
+	pthread_t		owner;
+	t_Perf			*perf;
+	t_Trace			*trace;
+	t_RenderStats	rs;
+	t_RenderStats	last;
+	bool			heatmap;
+}				t_Profiler;
+
+/**
+ * @struct t_BenchKey
+ * Point clé du trajet de caméra du banc d'essai.
+ *
+ * @param x Coordonnée X de la caméra sur la carte.
+ * @param y Coordonnée Y de la caméra sur la carte.
+ * @param angle Direction de la caméra en radians (0 vers l'est).
+ */
+typedef struct s_BenchKey
+{
+	double	x;
+	double	y;
+	double	angle;
+}				t_BenchKey;
+
+/**
+ * @struct t_Bench
+ * État du banc d'essai hors écran.
+ *
+ * @param keys Points clés du trajet, interpolés linéairement entre eux.
+ * @param n_keys Nombre de points clés (au moins 2).
+ * @param frames Nombre de frames à rendre.
+ * @param times Durée de rendu de chaque frame (ns).
+ * @param thumb Vignette RGB de la frame rendue, comparée à la référence.
+ * @param ref Vignette RGB lue dans l'image de référence.
+ * @param path Chemin de l'image de référence de la frame courante.
+ * @param failed Nombre de frames différentes de leur image de référence.
+ */
+typedef struct s_Bench
+{
+	t_BenchKey		keys[BENCH_MAX_KEYS];
+	int				n_keys;
+	int				frames;
+	long long		*times;
+	unsigned char	*thumb;
+	unsigned char	*ref;
+	char			path[PATH_MAX];
+	int				failed;
+}				t_Bench;
+
+/**
+ * @struct t_ReplayHeader
+ * En-tête du fichier d'enregistrement des entrées.
+ *
+ * @param magic REPLAY_MAGIC, pour reconnaître le fichier.
+ * @param version REPLAY_VERSION, le format des événements.
+ * @param tick_rate Fréquence de la simulation pendant l'enregistrement.
+ */
+typedef struct s_ReplayHeader
+{
+	int	magic;
+	int	version;
+	int	tick_rate;
+}				t_ReplayHeader;
+
+/**
+ * @struct t_ReplayEvent
+ * Événement du fichier d'enregistrement, écrit tel quel (8 octets).
+ *
+ * Un événement n'est écrit que pour les ticks où les touches maintenues
+ * changent, où une action est demandée ou où la souris a bougé.
+ *
+ * @param tick Tick de la simulation auquel l'événement s'applique.
+ * @param keys Touches enfoncées et actions demandées (INPUT_*), ou
+ * INPUT_END pour marquer la fin de l'enregistrement.
+ * @param dx Déplacement horizontal de la souris consommé par ce tick.
+ */
+typedef struct s_ReplayEvent
+{
+	unsigned int	tick;
+	unsigned short	keys;
+	short			dx;
+}				t_ReplayEvent;
+
+/**
+ * @struct t_Replay
+ * Enregistrement ou relecture des entrées de la simulation.
+ *
+ * @param file Le fichier d'enregistrement ouvert.
+ * @param mode REPLAY_RECORD ou REPLAY_PLAY.
+ * @param held Touches maintenues au dernier tick enregistré ou rejoué.
+ * @param next Prochain événement à rejouer.
+ * @param has_next false une fois la fin de l'enregistrement lue.
+ * @param end_tick Nombre de ticks à rejouer connu à ce stade.
+ * @param step Nombre de ticks simulés par frame pendant la relecture.
+ * @param due Nombre de ticks à simuler pendant la frame courante.
+ * @param frames Nombre de frames rendues pendant la relecture.
+ * @param start_ns Instant de début de la relecture (ns).
+ * @param hash Empreinte FNV-1a de toutes les frames rendues.
+ */
+typedef struct s_Replay
+{
+	FILE				*file;
+	int					mode;
+	int					held;
+	t_ReplayEvent		next;
+	bool				has_next;
+	long long			end_tick;
+	int					step;
+	int					due;
+	long long			frames;
+	long long			start_ns;
+	unsigned long long	hash;
+}				t_Replay;
+
+/**
+ * @struct t_Capture
+ * Capture des frames rendues vers des fichiers PPM ou un flux Y4M.
+ *
+ * Le rendu copie l'image du jeu dans un anneau de CAPTURE_SLOTS tampons
+ * alloués au démarrage; un thread d'écriture les encode et les écrit. Les
+ * deux threads ne partagent que les compteurs 'head' et 'tail' et le
+ * sémaphore 'ready', le rendu n'attend donc jamais l'écriture: si l'anneau
+ * est plein, la frame est perdue et comptée dans 'dropped'.
+ *
+ * @param ring Les CAPTURE_SLOTS tampons de l'anneau, à la suite,
+ * w * h pixels chacun.
+ * @param w Largeur des frames capturées, celle de la fenêtre au démarrage.
+ * @param h Hauteur des frames capturées.
+ * @param seq Numéro de la frame copiée dans chaque tampon.
+ * @param out Tampon d'encodage RGB ou YUV du thread d'écriture.
+ * @param name Le flux Y4M ou le préfixe des fichiers PPM ('--capture').
+ * @param path Chemin du fichier PPM en cours d'écriture.
+ * @param y4m true pour un flux Y4M unique, false pour un fichier PPM par frame.
+ * @param fd Descripteur du flux Y4M.
+ * @param head Nombre de tampons remplis par le rendu.
+ * @param tail Nombre de tampons écrits par le thread d'écriture.
+ * @param ready Sémaphore posté à chaque tampon rempli et à l'arrêt.
+ * @param thread Le thread d'écriture.
+ * @param started true une fois le sémaphore et le thread d'écriture créés.
+ * @param dropped Nombre de frames perdues faute de tampon libre.
+ * @param failed Nombre de frames dont l'écriture a échoué.
+ * @param trace La chronologie des frames, ou NULL.
+ */
+typedef struct s_Capture
+{
+	unsigned int		*ring;
+	int					w;
+	int					h;
+	long long			seq[CAPTURE_SLOTS];
+	unsigned char		*out;
+	char				*name;
+	char				path[PATH_MAX];
+	bool				y4m;
+	int					fd;
+	_Atomic long long	head;
+	_Atomic long long	tail;
+	sem_t				ready;
+	pthread_t			thread;
+	bool				started;
+	long long			dropped;
+	long long			failed;
+	t_Trace				*trace;
+}				t_Capture;
+
+/**
+ * @struct t_Font
+ * Police bitmap mise en cache pour l'affichage de texte dans l'image.
+ *
+ * @param cache Masques des glyphes agrandis, 'w' * 'h' octets par glyphe.
+ * @param w Largeur d'un glyphe agrandi en pixels.
+ * @param h Hauteur d'un glyphe agrandi en pixels.
+ */
+typedef struct s_Font
+{
+	unsigned char	*cache;
+	int				w;
+	int				h;
+}				t_Font;
+
 /**
  * @struct t_Cub3d
  * Main structure for managing the Cub3D game configuration.
@@ -358,6 +1261,8 @@ typedef struct s_Menu
  * @param img_floor Pointeur vers une image représentant le sol.
  * @param mouse_x Coordonnée X actuelle du curseur de la souris.
  * @param mouse_y Coordonnée Y actuelle du curseur de la souris.
+ * @param mouse_warp Flag indiquant qu'un replacement du pointeur au centre
+ * de la fenêtre est en attente de son événement.
  * @param cam Pointeur  vers la structure de configuration de la caméra.
  * @param player Pointeur vers la structure de configuration du lecteur.
  * @param map Pointeur vers la structure de configuration de la carte.
@@ -371,6 +1276,26 @@ typedef struct s_Menu
  * @param cam_ok Flag indiquant si la caméra est configurée.
  * @param menu_ok Flag indiquant si le menu principal est initialisé.
  * @param gun_ok Flag indiquant si l'arme du joueur est configurée.
+ * @param opt Pointeur vers les options de la ligne de commande.
+ * @param clock Pointeur vers l'horloge de cadencement des frames.
+ * @param sim Pointeur vers la simulation à pas fixe.
+ * @param prof Pointeur vers le profileur de frames.
+ * @param font Pointeur vers la police bitmap de l'interface.
+ * @param bench Pointeur vers le banc d'essai, ou NULL en jeu.
+ * @param replay Pointeur vers l'enregistrement ou la relecture des entrées,
+ * ou NULL.
+ * @param capture Pointeur vers la capture des frames, ou NULL.
+ * @param trace Pointeur vers la chronologie des frames, ou NULL.
+ * @param win Pointeur vers la taille de la fenêtre et la résolution de la vue
+ * 3D.
+ * @param drawn État de la simulation de la dernière frame rendue.
+ * @param redraw Flag forçant le rendu de la prochaine frame, ou du menu
+ * (fenêtre exposée ou redimensionnée, overlay ou carte de chaleur changés).
+ * @param menu_hover Boutons du menu survolés lors de leur dernier dessin.
+ * @param view Tampon de la vue 3D rangé par colonnes avec '--column-major',
+ * ou NULL.
+ * @param scaler Cache des tables de lignes de texture des colonnes de mur.
+ * @param atlas Atlas des textures des murs, des portes et des matériaux.
  */
 typedef struct s_Cub3d
 {
@@ -380,6 +1305,7 @@ typedef struct s_Cub3d
 	void			*img_floor;
 	int				mouse_x;
 	int				mouse_y;
+	bool			mouse_warp;
 	t_CameraConfig	*cam;
 	t_PlayerConfig	*player;
 	t_MapConfig		*map;
@@ -393,6 +1319,22 @@ typedef struct s_Cub3d
 	bool			cam_ok;
 	bool			menu_ok;
 	bool			gun_ok;
+	t_Options		*opt;
+	t_FrameClock	*clock;
+	t_Simulation	*sim;
+	t_Profiler		*prof;
+	t_Font			*font;
+	t_Bench			*bench;
+	t_Replay		*replay;
+	t_Capture		*capture;
+	t_Trace			*trace;
+	t_WindowConfig	*win;
+	t_SimState		drawn;
+	bool			redraw;
+	int				menu_hover;
+	t_ImageControl	*view;
+	t_ScalerCache	*scaler;
+	t_Atlas			*atlas;
 }				t_Cub3d;
 
 // FONCTIONS DU CYCLE DE VIE DU PROGRAMME
@@ -402,6 +1344,8 @@ void	free_textures(t_Cub3d *cub, t_TextureSetup *texture);
 void	free_gun(t_Cub3d *cub);
 void	free_cam(t_Cub3d *cub);
 void	free_menu(t_Cub3d *cub);
+void	free_timing(t_Cub3d *cub);
+void	free_bench(t_Cub3d *cub);
 int		gameloop(t_Cub3d *cub);
 
 // FONCTIONS D'ANALYSE DE CARTE ET DE FICHIER
@@ -427,6 +1371,10 @@ int		check_walls_doors(t_MapConfig *m, int i, int j);
 int		check_north_south(t_Cub3d *cub, char *line);
 int		check_west_east(t_Cub3d *cub, char *line);
 int		fill_bonus_info(t_Cub3d *cub, char *line);
+int		is_material(char *line);
+int		parse_materials(t_Cub3d *cub);
+int		material_cell(t_MapConfig *m, char c);
+int		is_wall(char c);
 
 // FONCTIONS DE GESTION DES JOUEURS
 int		set_player_orientation(t_Cub3d *cub, char c);
@@ -447,13 +1395,31 @@ int		convert_textures(t_Cub3d *cub);
 int		check_access(t_Cub3d *cub);
 int		is_xpm(t_Cub3d *cub, int id);
 void	my_mlx_pixel_put(t_ImageControl *img, int x, int y, int color);
+void	render_frame(t_Cub3d *cub);
+int		font_init(t_Cub3d *cub);
+void	draw_text(t_Cub3d *cub, int x, int y, char *s);
 void	load_xpm(t_Cub3d *c, t_ImageControl *i, char *file);
+int		window_init(t_Cub3d *cub);
+void	window_set_scale(t_WindowConfig *w, int scale);
+int		window_create(t_Cub3d *cub);
+int		on_window_configure(int width, int height, t_Cub3d *cub);
+void	window_resize(t_Cub3d *cub);
+void	window_update(t_Cub3d *cub);
+void	window_upscale(t_Cub3d *cub);
+void	view_update(t_Cub3d *cub);
+void	view_pixel_put(t_Cub3d *cub, int x, int y, int color);
+void	view_transpose(t_Cub3d *cub);
+void	view_free(t_Cub3d *cub);
+int		frame_dirty(t_Cub3d *cub);
+int		frame_idle(t_Cub3d *cub);
+int		on_window_expose(t_Cub3d *cub);
 
 // EVENT HANDLING FUNCTIONS
 // Functions related to handling user input events
 void	hook_events(t_Cub3d *cub);
 int		deal_key(int key, t_Cub3d *cub);
-int		on_mouse_move(t_Cub3d *cub);
+int		on_mouse_move(int x, int y, t_Cub3d *cub);
+void	apply_mouse_look(t_Cub3d *cub);
 int		win_close(t_Cub3d *cub);
 
 // PLAYER HANDLING FUNCTIONS
@@ -461,8 +1427,10 @@ int		win_close(t_Cub3d *cub);
 int		player_init(t_Cub3d *cub);
 void	set_player_position(t_Cub3d *cub);
 int		use_action(t_PlayerConfig *p, t_MapConfig *m);
-void	shoot_gun(t_Cub3d *cub, t_PlayerConfig *p, int *counter);
+void	shoot_gun(t_Cub3d *cub, t_PlayerConfig *p, int frame);
+void	gun_animation_tick(t_PlayerConfig *p);
 int		readmove(t_Cub3d *cub, t_PlayerConfig *p);
+void	rotate_view(t_Cub3d *cub, double cs, double sn);
 void	apply_for_back_move(t_Cub3d *cub, t_PlayerConfig *p, int dir);
 void	apply_left_right_move(t_Cub3d *cub, t_PlayerConfig *p, int dir);
 void	check_wall_hit(t_Cub3d *cub, double temp_x, double temp_y);
@@ -474,13 +1442,22 @@ void	cam_utils_init(t_CameraConfig *cam);
 
 // FONCTIONS DE DIFFUSION DE RAYONS
 void	draw_rays(t_Cub3d *cub);
+void	init_rays(t_Cub3d *cub, t_CameraConfig *cam, int x);
+void	ray_table_update(t_Cub3d *cub);
+void	cast_rays(t_Cub3d *cub);
+void	texture_rays(t_Cub3d *cub);
 void	ray_per_colum(t_Cub3d *cub, t_CameraConfig *cam, int x);
 void	ray_map_pos(t_Cub3d *cub, t_CameraConfig *cam);
 void	ray_delt_dist(t_CameraConfig *cam);
-void	step_calculation(t_CameraConfig *cam, t_PlayerConfig *p);
+void	step_calculation(t_CameraConfig *cam, t_SimState *p);
 void	apply_dda(t_CameraConfig *cam, t_MapConfig *m);
 void	calculate_wall_height(t_CameraConfig *cam);
 void	get_wall_direction(t_MapConfig *m, t_CameraConfig *c);
+long long	fix_from(double d);
+void	step_fixed(t_CameraConfig *c);
+void	dda_fixed(t_CameraConfig *c, t_MapConfig *m);
+void	wall_height_fixed(t_CameraConfig *c);
+void	texture_fixed(t_Cub3d *cub, t_CameraConfig *c, int x, int id);
 
 // FONCTIONS DE LA MINICARTE
 // Fonctions liées au dessin de la minimap
@@ -499,6 +1476,35 @@ int		max_x_array(t_Cub3d *cub);
 void	render_ceilling_floor(t_Cub3d *cub);
 int		*get_texture_addr(t_ImageControl *i);
 void	apply_texture(t_Cub3d *cub, t_CameraConfig *c, int x, int id);
+int		apply_shader(int color, int id);
+t_ImageControl	*get_img_struct(t_Cub3d *cub, int id);
+t_Scaler	*scaler_get(t_ScalerCache *sc, t_CameraConfig *c,
+				t_ImageControl *img);
+int		texture_wrap(int row, int wrap);
+int		texture_column(t_Cub3d *cub, t_CameraConfig *c, t_ImageControl *img,
+			int x);
+void	col_gather_flat(t_Column *k);
+void	col_gather_shade(t_Column *k);
+void	col_step_pow2_flat(t_Column *k);
+void	col_step_pow2_shade(t_Column *k);
+void	col_step_any_flat(t_Column *k);
+void	col_step_any_shade(t_Column *k);
+void	col_index_gather(t_Column *k);
+void	col_index_pow2(t_Column *k);
+void	col_index_any(t_Column *k);
+int		scaler_init(t_Cub3d *cub);
+int		atlas_build(t_Cub3d *cub);
+void	atlas_free(t_Cub3d *cub);
+int		palette_cut(t_PalCut *p);
+int		palette_build(t_Cub3d *cub);
+void	atlas_report(t_Cub3d *cub);
+int		check_materials(t_Cub3d *cub);
+void	load_materials(t_Cub3d *cub);
+void	free_materials(t_Cub3d *cub);
+int		scaler_evict(t_ScalerCache *sc);
+void	scaler_free(t_Cub3d *cub);
+void	scaler_stats(t_Cub3d *cub, t_RenderStats *s);
+void	scaler_report(t_Cub3d *cub);
 int		my_mlx_pixel_get(t_ImageControl *img, int x, int y);
 
 // MENU PRINCIPAL
@@ -509,8 +1515,94 @@ void	update_button(t_Cub3d *c, t_ImageControl *i, int p, char b);
 
 // UTILS
 void	cub3d_new_image(t_Cub3d *cub);
-void	restore_doors(t_Cub3d *cub, int x, int y, int i);
+void	restore_doors(t_Cub3d *cub);
+int		init_doors(t_MapConfig *m);
 int		mouse_hook(int key, int x, int y, t_Cub3d *cub);
 void	ft_clean_gnl(int fd, char *line);
+void	parse_options(t_Cub3d *cub, int ac, char **av);
+void	usage_exit(char *msg);
+int		option_value(int ac, char **av, int i);
+int		parse_run_option(t_Options *o, int ac, char **av, int i);
+int		parse_window_option(t_Options *o, int ac, char **av, int i);
+void	check_options(t_Options *o);
+
+// FONCTIONS DE CADENCEMENT DES FRAMES
+long long	get_time_ns(void);
+int		frame_clock_init(t_Cub3d *cub, int fps);
+void	frame_begin(t_FrameClock *c);
+int		frame_ready(t_Cub3d *cub);
+double	get_frame_time(t_Cub3d *cub);
+
+// FONCTIONS DE LA SIMULATION A PAS FIXE
+int		sim_init(t_Cub3d *cub, int hz);
+void	sim_tick(t_Cub3d *cub);
+void	sim_update(t_Cub3d *cub);
+void	sim_view(t_Cub3d *cub);
+void	capture_state(t_Cub3d *cub, t_SimState *s);
+double	sim_snapshot(t_Simulation *s, t_SimState **a, t_SimState **b);
+void	sim_start(t_Cub3d *cub, bool threaded);
+void	sim_stop(t_Cub3d *cub);
+void	sim_input(t_Cub3d *cub);
+int		sim_world(t_Cub3d *cub);
+void	sim_world_free(t_Cub3d *cub);
+void	sim_publish(t_Cub3d *cub);
+void	sim_doors(t_Cub3d *cub);
+
+// PROFILEUR DE FRAMES
+int		prof_init(t_Cub3d *cub);
+void	prof_begin(t_Profiler *p, int stage);
+void	prof_end(t_Profiler *p, int stage);
+void	prof_frame_end(t_Profiler *p);
+void	prof_draw_overlay(t_Cub3d *cub);
+char	*prof_stage_name(int stage);
+int		perf_init(t_Profiler *p);
+char	*perf_event_name(int event);
+void	perf_read(t_Perf *pf, long long *out);
+void	perf_csv_header(t_Profiler *p);
+void	perf_free(t_Perf *pf);
+void	perf_end(t_Perf *pf, int stage);
+void	perf_frame_end(t_Profiler *p);
+int		perf_overlay_line(t_Perf *pf, int stage, char *line, int size);
+void	stats_rays(t_Cub3d *cub);
+void	stats_heatmap(t_Cub3d *cub);
+void	stats_frame_end(t_Profiler *p);
+void	stats_csv_header(t_Profiler *p);
+
+// BANC D'ESSAI HORS ECRAN
+int		bench_path(t_Cub3d *cub);
+void	bench_pose(t_Cub3d *cub, int frame);
+void	bench_run(t_Cub3d *cub);
+int		golden_init(t_Cub3d *cub);
+void	golden_check(t_Cub3d *cub, int frame);
+void	golden_path(t_Cub3d *cub, int frame);
+int		golden_read(char *path, unsigned long long *hash, unsigned char *buf);
+int		golden_write(char *path, unsigned long long hash, unsigned char *buf);
+int		golden_diff(unsigned char *a, unsigned char *b);
+
+// ENREGISTREMENT ET RELECTURE DES ENTREES
+int		replay_init(t_Cub3d *cub);
+void	replay_start(t_Cub3d *cub);
+void	replay_close(t_Cub3d *cub);
+int		replay_next(t_Replay *r);
+int		replay_tick(t_Cub3d *cub, int in);
+void	replay_step(t_Cub3d *cub);
+unsigned long long	frame_hash(t_ImageControl *img, int w, int h,
+			unsigned long long hash);
+
+// CAPTURE DES FRAMES
+int		capture_init(t_Cub3d *cub);
+void	capture_frame(t_Cub3d *cub);
+void	capture_close(t_Cub3d *cub);
+void	*capture_main(void *arg);
+void	capture_rgb(t_Capture *c, unsigned int *src);
+void	capture_yuv(t_Capture *c, unsigned int *src);
+
+// CHRONOLOGIE DES FRAMES
+int		trace_init(t_Cub3d *cub);
+void	trace_event(t_Trace *t, const char *name, char ph, const char *detail);
+void	trace_close(t_Cub3d *cub);
+void	trace_flush(t_Trace *t);
+void	trace_signals(t_Trace *t);
+void	trace_poll(t_Cub3d *cub);
 
 #endif
@@ -0,0 +1,117 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Compare deux durées pour le tri avec 'qsort'.
+ *
+ * @param a Pointeur vers la première durée.
+ * @param b Pointeur vers la seconde durée.
+ * @return Un entier négatif, nul ou positif selon l'ordre des durées.
+ */
+static int	cmp_time(const void *a, const void *b)
+{
+	long long	x;
+	long long	y;
+
+	x = *(const long long *)a;
+	y = *(const long long *)b;
+	return ((x > y) - (x < y));
+}
+
+/**
+ * @brief Affiche le résultat du banc d'essai.
+ *
+ * Les durées de frame sont triées pour en extraire la médiane (p50) et le
+ * 99e centile (p99). Le débit est donné en frames et en pixels par seconde,
+ * à partir du temps de rendu cumulé, puis le bilan du cache des tables de
+ * lignes de texture et la taille de l'atlas des textures.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param total Temps de rendu cumulé de toutes les frames (ns).
+ */
+static void	bench_report(t_Cub3d *cub, long long total)
+{
+	t_Bench		*b;
+	long long	pixels;
+	double		secs;
+
+	b = cub->bench;
+	qsort(b->times, b->frames, sizeof(long long), cmp_time);
+	pixels = (long long)b->frames * cub->win->width * cub->win->height;
+	secs = total / 1e9;
+	printf("bench: %d frames at %dx%d in %.3f s, %.1f fps\n",
+		b->frames, cub->win->width, cub->win->height, secs, b->frames / secs);
+	printf("bench: frame p50 %.3f ms, p99 %.3f ms\n",
+		b->times[b->frames * 50 / 100] / 1e6,
+		b->times[b->frames * 99 / 100] / 1e6);
+	printf("bench: %lld pixels, %.1f Mpx/s\n", pixels, pixels / secs / 1e6);
+	scaler_report(cub);
+	atlas_report(cub);
+}
+
+/**
+ * @brief Rend une frame du banc d'essai dans le tampon hors écran.
+ *
+ * La caméra est placée sur le trajet, puis la frame complète est rendue
+ * comme en jeu (minimap, vue 3D, pistolet, réticule) et envoyée à la
+ * fenêtre du backend nul de MiniLibX. Les étapes sont mesurées par le
+ * profileur, ce qui permet d'utiliser '--profile-out'. Un Ctrl-C reçu avec
+ * '--trace' termine le banc d'essai avant la frame ('trace_poll').
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param frame L'index de la frame à rendre.
+ * @return La durée de rendu de la frame (ns).
+ */
+static long long	bench_frame(t_Cub3d *cub, int frame)
+{
+	long long	start;
+
+	trace_poll(cub);
+	bench_pose(cub, frame);
+	start = get_time_ns();
+	prof_begin(cub->prof, PROF_FRAME);
+	render_frame(cub);
+	prof_end(cub->prof, PROF_FRAME);
+	prof_frame_end(cub->prof);
+	return (get_time_ns() - start);
+}
+
+/**
+ * @brief Exécute le banc d'essai hors écran et termine le programme.
+ *
+ * La fonction 'bench_run' prépare le trajet de caméra, rend le nombre de
+ * frames demandé dans les images en mémoire du backend nul, sans serveur X
+ * ni menu, puis affiche le débit et les centiles de durée de frame. Avec
+ * '--golden', chaque frame est comparée à son image de référence
+ * ('golden_check') et le programme termine en échec si l'une d'elles
+ * diffère. Elle ne revient pas.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	bench_run(t_Cub3d *cub)
+{
+	long long	total;
+	int			i;
+
+	if (bench_path(cub) || golden_init(cub))
+	{
+		free_main(cub);
+		printf("Error: Failed loading the bench camera path\n");
+		exit(EXIT_FAILURE);
+	}
+	total = 0;
+	i = 0;
+	while (i < cub->bench->frames)
+	{
+		cub->bench->times[i] = bench_frame(cub, i);
+		total += cub->bench->times[i];
+		if (cub->opt->golden)
+			golden_check(cub, i);
+		i++;
+	}
+	bench_report(cub, total);
+	i = EXIT_SUCCESS;
+	if (cub->bench->failed)
+		i = EXIT_FAILURE;
+	free_main(cub);
+	exit(i);
+}
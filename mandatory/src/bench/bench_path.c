@@ -0,0 +1,147 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Vérifie qu'un point clé se trouve sur une case libre de la carte.
+ *
+ * @param m Pointeur vers la configuration de la carte.
+ * @param k Pointeur vers le point clé à vérifier.
+ * @return 1 si la caméra peut se trouver à cette position, 0 sinon.
+ */
+static int	key_in_map(t_MapConfig *m, t_BenchKey *k)
+{
+	char	*row;
+
+	if (k->x < 0 || k->y < 0 || k->y >= m->n_lines)
+		return (0);
+	row = m->matrix[(int)k->y];
+	if (!row || k->x >= ft_strlen(row))
+		return (0);
+	return (!ft_strchr("123456789 ", row[(int)k->x]));
+}
+
+/**
+ * @brief Lit le trajet de caméra depuis un fichier.
+ *
+ * Chaque point clé est formé de trois nombres séparés par des blancs: la
+ * position X et Y sur la carte et la direction en degrés (0 vers l'est, 90
+ * vers le sud). La lecture s'arrête au premier élément invalide.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param b Pointeur vers le banc d'essai à remplir.
+ * @return 0 en cas de succès, 1 si le fichier est illisible ou invalide.
+ */
+static int	read_path(t_Cub3d *cub, t_Bench *b)
+{
+	FILE		*f;
+	t_BenchKey	*k;
+
+	f = fopen(cub->opt->bench_path, "r");
+	if (!f)
+		return (1);
+	k = &b->keys[0];
+	while (b->n_keys < BENCH_MAX_KEYS
+		&& fscanf(f, "%lf %lf %lf", &k->x, &k->y, &k->angle) == 3)
+	{
+		k->angle *= M_PI / 180.0;
+		if (!key_in_map(cub->map, k))
+			return (fclose(f), 1);
+		k = &b->keys[++b->n_keys];
+	}
+	fclose(f);
+	return (b->n_keys == 0);
+}
+
+/**
+ * @brief Génère le trajet de caméra par défaut.
+ *
+ * Sans fichier '--path', la caméra fait un tour complet sur place depuis la
+ * position de départ du joueur, ce qui fait défiler toutes les orientations
+ * de murs. Le tour s'arrête une frame avant de revenir au départ, pour que
+ * les frames soient toutes différentes et régulièrement espacées (avec
+ * '--golden', les GOLDEN_POSES poses regardent dans quatre directions).
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param b Pointeur vers le banc d'essai à remplir.
+ */
+static void	default_path(t_Cub3d *cub, t_Bench *b)
+{
+	b->keys[0].x = cub->player->pos_x;
+	b->keys[0].y = cub->player->pos_y;
+	b->keys[0].angle = atan2(cub->player->dir_y, cub->player->dir_x);
+	b->keys[1] = b->keys[0];
+	b->keys[1].angle += 2 * M_PI * (b->frames - 1) / b->frames;
+	b->n_keys = 2;
+}
+
+/**
+ * @brief Prépare le trajet de caméra du banc d'essai.
+ *
+ * La fonction 'bench_path' alloue le banc d'essai et la table des durées de
+ * frame. Le trajet est lu depuis le fichier '--path' s'il est fourni, sinon
+ * le trajet par défaut est généré. Un trajet d'un seul point est doublé pour
+ * toujours pouvoir interpoler.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'erreur.
+ */
+int	bench_path(t_Cub3d *cub)
+{
+	t_Bench	*b;
+
+	b = ft_calloc(1, sizeof(t_Bench));
+	cub->bench = b;
+	if (!b)
+		return (1);
+	b->frames = cub->opt->bench_frames;
+	b->times = ft_calloc(b->frames, sizeof(long long));
+	if (!b->times)
+		return (1);
+	if (!cub->opt->bench_path)
+	{
+		default_path(cub, b);
+		return (0);
+	}
+	if (read_path(cub, b))
+		return (1);
+	if (b->n_keys == 1)
+		b->keys[b->n_keys++] = b->keys[0];
+	return (0);
+}
+
+/**
+ * @brief Place la caméra sur le trajet pour une frame donnée.
+ *
+ * La fonction 'bench_pose' répartit les frames uniformément sur le trajet et
+ * interpole linéairement la position et l'angle entre les deux points clés
+ * encadrants. La pose est écrite dans la vue de la simulation
+ * ('cub->sim->view'), seule lue par le rendu; le plan de la caméra reste
+ * perpendiculaire à la direction, de longueur 'fov'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param frame L'index de la frame à rendre.
+ */
+void	bench_pose(t_Cub3d *cub, int frame)
+{
+	t_Bench		*b;
+	t_SimState	*v;
+	double		t;
+	double		angle;
+	int			k;
+
+	b = cub->bench;
+	v = &cub->sim->view;
+	t = 0;
+	if (b->frames > 1)
+		t = (double)frame * (b->n_keys - 1) / (b->frames - 1);
+	k = (int)t;
+	if (k > b->n_keys - 2)
+		k = b->n_keys - 2;
+	t -= k;
+	v->pos_x = b->keys[k].x + (b->keys[k + 1].x - b->keys[k].x) * t;
+	v->pos_y = b->keys[k].y + (b->keys[k + 1].y - b->keys[k].y) * t;
+	angle = b->keys[k].angle + (b->keys[k + 1].angle - b->keys[k].angle) * t;
+	v->dir_x = cos(angle);
+	v->dir_y = sin(angle);
+	v->plane_x = -v->dir_y * cub->cam->fov;
+	v->plane_y = v->dir_x * cub->cam->fov;
+}
@@ -0,0 +1,129 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Convertit une frame en pixels RGB de 3 octets pour le format PPM.
+ *
+ * @param c Pointeur vers la capture, dont le tampon 'out' reçoit le résultat.
+ * @param src Les pixels de la frame (0xRRGGBB).
+ */
+void	capture_rgb(t_Capture *c, unsigned int *src)
+{
+	unsigned char	*dst;
+	int				i;
+
+	dst = c->out;
+	i = 0;
+	while (i < c->w * c->h)
+	{
+		dst[0] = src[i] >> 16;
+		dst[1] = src[i] >> 8;
+		dst[2] = src[i];
+		dst += 3;
+		i++;
+	}
+}
+
+/**
+ * @brief Calcule le plan de luminance (Y) d'une frame.
+ *
+ * Les coefficients BT.601 sont appliqués en virgule fixe sur 8 bits.
+ *
+ * @param dst Le plan Y, un octet par pixel.
+ * @param src Les pixels de la frame (0xRRGGBB).
+ * @param n Le nombre de pixels de la frame.
+ */
+static void	yuv_luma(unsigned char *dst, unsigned int *src, int n)
+{
+	int	i;
+
+	i = 0;
+	while (i < n)
+	{
+		dst[i] = (77 * (src[i] >> 16 & 255) + 150 * (src[i] >> 8 & 255)
+				+ 29 * (src[i] & 255)) >> 8;
+		i++;
+	}
+}
+
+/**
+ * @brief Calcule la moyenne d'un bloc de 2x2 pixels, composante par
+ * composante.
+ *
+ * @param p Le pixel en haut à gauche du bloc.
+ * @param w Largeur d'une ligne en pixels.
+ * @return Le pixel moyen (0xRRGGBB).
+ */
+static unsigned int	avg4(unsigned int *p, int w)
+{
+	unsigned int	color;
+	unsigned int	sum;
+	int				shift;
+
+	color = 0;
+	shift = 0;
+	while (shift < 24)
+	{
+		sum = (p[0] >> shift & 255) + (p[1] >> shift & 255)
+			+ (p[w] >> shift & 255) + (p[w + 1] >> shift & 255);
+		color |= (sum >> 2) << shift;
+		shift += 8;
+	}
+	return (color);
+}
+
+/**
+ * @brief Calcule les deux composantes de chrominance d'un pixel.
+ *
+ * Coefficients BT.601 en plage complète, en virgule fixe sur 8 bits; le
+ * décalage de 128 est ajouté avant la division pour rester positif.
+ *
+ * @param px Le pixel (0xRRGGBB).
+ * @param u Reçoit la composante Cb.
+ * @param v Reçoit la composante Cr.
+ */
+static void	yuv_chroma(unsigned int px, unsigned char *u, unsigned char *v)
+{
+	int	r;
+	int	g;
+	int	b;
+
+	r = px >> 16 & 255;
+	g = px >> 8 & 255;
+	b = px & 255;
+	*u = (-43 * r - 85 * g + 128 * b + 32768) >> 8;
+	*v = (128 * r - 107 * g - 21 * b + 32768) >> 8;
+}
+
+/**
+ * @brief Convertit une frame au format YUV 4:2:0 planaire du flux Y4M.
+ *
+ * Le plan Y est suivi des plans Cb et Cr, sous-échantillonnés en moyennant
+ * chaque bloc de 2x2 pixels.
+ *
+ * @param c Pointeur vers la capture, dont le tampon 'out' reçoit le résultat.
+ * @param src Les pixels de la frame (0xRRGGBB).
+ */
+void	capture_yuv(t_Capture *c, unsigned int *src)
+{
+	unsigned char	*u;
+	unsigned char	*v;
+	int				x;
+	int				y;
+
+	yuv_luma(c->out, src, c->w * c->h);
+	u = c->out + c->w * c->h;
+	v = u + c->w * c->h / 4;
+	y = 0;
+	while (y < c->h / 2)
+	{
+		x = 0;
+		while (x < c->w / 2)
+		{
+			yuv_chroma(avg4(src + 2 * y * c->w + 2 * x, c->w), u, v);
+			u++;
+			v++;
+			x++;
+		}
+		y++;
+	}
+}
@@ -0,0 +1,125 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Écrit entièrement un tampon dans un descripteur de fichier.
+ *
+ * @param fd Le descripteur de fichier.
+ * @param buf Le tampon à écrire.
+ * @param n Le nombre d'octets à écrire.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+static int	write_all(int fd, unsigned char *buf, long long n)
+{
+	ssize_t	done;
+
+	while (n > 0)
+	{
+		done = write(fd, buf, n);
+		if (done < 0 && errno != EINTR)
+			return (1);
+		if (done > 0)
+		{
+			buf += done;
+			n -= done;
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Écrit une frame dans son propre fichier PPM (P6).
+ *
+ * Le fichier s'appelle '<préfixe>NNNNNN.ppm', NNNNNN étant le numéro de la
+ * frame depuis le début de la capture: les frames perdues laissent un trou
+ * dans la numérotation.
+ *
+ * @param c Pointeur vers la capture.
+ * @param src Les pixels de la frame.
+ * @param seq Le numéro de la frame.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+static int	write_ppm(t_Capture *c, unsigned int *src, long long seq)
+{
+	char	head[32];
+	int		len;
+	int		fd;
+	int		err;
+
+	capture_rgb(c, src);
+	snprintf(c->path, PATH_MAX, "%s%06lld.ppm", c->name, seq);
+	fd = open(c->path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		return (1);
+	len = snprintf(head, sizeof(head), "P6\n%d %d\n255\n", c->w, c->h);
+	err = write_all(fd, (unsigned char *)head, len)
+		|| write_all(fd, c->out, (long long)c->w * c->h * 3);
+	close(fd);
+	return (err);
+}
+
+/**
+ * @brief Ajoute une frame au flux Y4M.
+ *
+ * @param c Pointeur vers la capture.
+ * @param src Les pixels de la frame.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+static int	write_y4m(t_Capture *c, unsigned int *src)
+{
+	capture_yuv(c, src);
+	return (write_all(c->fd, (unsigned char *)"FRAME\n", 6)
+		|| write_all(c->fd, c->out, (long long)c->w * c->h * 3 / 2));
+}
+
+/**
+ * @brief Attend qu'un tampon soit publié ou que la capture s'arrête.
+ *
+ * @param c Pointeur vers la capture.
+ * @return 0 au réveil, 1 si le sémaphore est inutilisable.
+ */
+static int	capture_wait(t_Capture *c)
+{
+	while (sem_wait(&c->ready))
+	{
+		if (errno != EINTR)
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Boucle du thread d'écriture de la capture.
+ *
+ * Chaque réveil correspond à un tampon publié par 'capture_frame', sauf le
+ * dernier, posté par 'capture_close': il trouve l'anneau vide et termine le
+ * thread. Un tampon n'est rendu au rendu (en avançant 'tail') qu'une fois
+ * entièrement encodé et écrit.
+ *
+ * @param arg Pointeur vers la capture.
+ * @return Toujours NULL.
+ */
+void	*capture_main(void *arg)
+{
+	t_Capture		*c;
+	long long		tail;
+	unsigned int	*src;
+	int				slot;
+
+	c = arg;
+	while (!capture_wait(c))
+	{
+		tail = atomic_load(&c->tail);
+		if (tail == atomic_load(&c->head))
+			return (NULL);
+		slot = tail % CAPTURE_SLOTS;
+		src = c->ring + (size_t)slot * c->w * c->h;
+		trace_event(c->trace, "capture_write", 'B', NULL);
+		if (c->y4m)
+			c->failed += write_y4m(c, src);
+		else
+			c->failed += write_ppm(c, src, c->seq[slot]);
+		trace_event(c->trace, "capture_write", 'E', NULL);
+		atomic_store(&c->tail, tail + 1);
+	}
+	return (NULL);
+}
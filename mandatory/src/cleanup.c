@@ -71,7 +71,8 @@ void	free_textures(t_Cub3d *cub, t_TextureSetup *texture)
  * Il vérifie si Flag 'graphics_ok' est défini pour s'assurer que les graphiques
  * contexte et les textures ont été initialisés avec succès. Si oui, il procède à
  * libérez les textures des murs nord, sud, ouest et est en utilisant le
- * fonction `free_textures`. Après avoir libéré les textures, il détruit le
+ * fonction `free_textures`, ainsi que le cache des tables de lignes de
+ * texture et l'atlas des textures. Après avoir libéré les textures, il détruit le
  * fenêtre d'application utilisant 'mlx_destroy_window', libère l'affichage, et
  * libère la mémoire allouée pour le contexte MiniLibX.
  *
@@ -83,6 +84,8 @@ static void	free_graphics(t_Cub3d *cub)
 	free_cam(cub);
 	free_gun(cub);
 	free_menu(cub);
+	scaler_free(cub);
+	atlas_free(cub);
 	if (cub->graphics_ok)
 	{
 		if (cub->img)
@@ -141,24 +144,40 @@ static void	free_minimap(t_Cub3d *cub)
  * initialisé et le libère si nécessaire.
  * 7. Vérifie si la structure de joueur ('cub- > player') est initialisée
  * et le libère si nécessaire.
- * 8. Enfin, libère la mémoire associée à la structure de la carte du jeu
+ * 8. Libère la mémoire associée à la structure de la carte du jeu
  * ('cub->map').
+ * Avant tout, 'free_timing' arrête le thread de simulation, qui accède au
+ * joueur et à la carte, puis libère l'horloge de frames, la simulation, le
+ * profileur et les options de la ligne de commande. La chronologie '--trace'
+ * est alors écrite, avant que les noms des textures ne soient libérés.
  *
  * @param cub Pointeur vers la structure de configuration principale du jeu Cub3D.
  */
 void	free_main(t_Cub3d *cub)
 {
+	replay_close(cub);
+	capture_close(cub);
+	free_timing(cub);
+	trace_close(cub);
+	view_free(cub);
 	free_minimap(cub);
 	free_graphics(cub);
 	free_map(cub);
 	if (cub->cam_ok)
+	{
+		free(cub->cam->hits);
+		free(cub->cam->rays);
 		free(cub->cam);
+	}
 	if (cub->map->matrix)
 		free(cub->map->matrix);
 	if (cub->map->filename)
 		free(cub->map->filename);
 	if (cub->player)
 		free(cub->player);
+	if (cub->map->doors)
+		free(cub->map->doors);
 	if (cub->map)
 		free(cub->map);
+	free(cub->win);
 }
\ No newline at end of file
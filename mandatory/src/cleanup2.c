@@ -54,7 +54,8 @@ void	free_gun(t_Cub3d *cub)
  * La fonction ('free_cam') est responsable de la libération de la mémoire et des ressources
  * associé aux textures et configurations de caméra dans le jeu Cub3D. Il
  * libère de la mémoire allouée pour diverses textures, y compris nord, sud,
- * textures ouest et est, ainsi que des textures de porte en cas de bonus.
+ * textures ouest et est, ainsi que des textures de porte en cas de bonus
+ * et des matériaux déclarés.
  * Si les ressources liées aux fichiers sont initialisées Flag ('files_ok'), cela libère le
  * mémoire utilisée pour les textures stockées dans la structure de la caméra. Enfin, le
  * la fonction libère la mémoire allouée pour le tableau de textures de la caméra et d'autres
@@ -77,6 +78,7 @@ void	free_cam(t_Cub3d *cub)
 		free_textures(cub, cub->map->tex_east);
 	if (BONUS && cub->map->tex_door)
 		free_textures(cub, cub->map->tex_door);
+	free_materials(cub);
 	if (cub->files_ok)
 	{
 		while (i < 4 + BONUS)
@@ -87,4 +89,52 @@ void	free_cam(t_Cub3d *cub)
 		}
 		free(cub->cam->tex);
 	}
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Libère le banc d'essai, ses durées de frame et ses vignettes.
+ *
+ * @param cub Pointeur vers la structure de configuration du jeu Cub3D.
+ */
+void	free_bench(t_Cub3d *cub)
+{
+	if (!cub->bench)
+		return ;
+	free(cub->bench->times);
+	free(cub->bench->thumb);
+	free(cub->bench->ref);
+	free(cub->bench);
+	cub->bench = NULL;
+}
+
+/**
+ * @brief Libère les structures de cadencement, de simulation et de profilage.
+ *
+ * La fonction 'free_timing' arrête d'abord le thread de simulation s'il est
+ * actif, puis libère l'horloge de frames, la simulation, le profileur (en
+ * fermant le fichier CSV et les compteurs matériels), la police de
+ * l'interface, le banc d'essai et les options de la ligne de commande.
+ *
+ * @param cub Pointeur vers la structure de configuration du jeu Cub3D.
+ */
+void	free_timing(t_Cub3d *cub)
+{
+	sim_stop(cub);
+	free(cub->clock);
+	free(cub->sim);
+	if (cub->prof && cub->prof->csv)
+		fclose(cub->prof->csv);
+	if (cub->prof)
+		perf_free(cub->prof->perf);
+	free(cub->prof);
+	if (cub->font)
+		free(cub->font->cache);
+	free(cub->font);
+	free_bench(cub);
+	free(cub->opt);
+	cub->clock = NULL;
+	cub->sim = NULL;
+	cub->prof = NULL;
+	cub->font = NULL;
+	cub->opt = NULL;
+}
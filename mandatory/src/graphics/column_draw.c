@@ -0,0 +1,147 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie le facteur d'ombrage d'une face, celui de 'apply_shader'.
+ *
+ * @param id L'identifiant de la face touchée (nord, sud, ouest, est, porte).
+ * @return Le facteur, ou 0 si la face n'est pas ombrée (nord et portes).
+ */
+static float	column_shade(int id)
+{
+	if (id == 2)
+		return (0.6);
+	if (id == 3)
+		return (0.4);
+	if (id == 4)
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Résout la colonne de texture lue et son ombrage.
+ *
+ * Avec '--indexed', la colonne est lue dans la texture indexée de l'atlas,
+ * d'une largeur de texture par ligne, et l'ombrage est la ligne de la table
+ * d'ombrage de la face (la première pour les portes, comme le nord).
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param c Pointeur vers la configuration de la caméra, 'tex_x' rempli.
+ * @param img La texture du mur.
+ * @param k La colonne à dessiner.
+ */
+static void	column_source(t_Cub3d *cub, t_CameraConfig *c, t_ImageControl *img,
+		t_Column *k)
+{
+	k->src = (unsigned int *)img->addr + c->tex_x;
+	k->tex_pitch = img->len / 4;
+	k->shade = column_shade(c->wall_dir);
+	k->isrc = cub->atlas->index[c->wall_tex];
+	k->cmap = NULL;
+	if (!k->isrc)
+		return ;
+	k->isrc += c->tex_x;
+	k->tex_pitch = img->width;
+	if (c->wall_dir == 9)
+		k->cmap = cub->atlas->pal->cmap[0];
+	else
+		k->cmap = cub->atlas->pal->cmap[c->wall_dir - 1];
+}
+
+/**
+ * @brief Résout le premier pixel écrit par la colonne et l'écart entre ses
+ * pixels.
+ *
+ * Avec '--column-major', la colonne est contiguë dans le tampon de la vue;
+ * sinon ses pixels sont espacés d'une ligne de l'image du jeu. Les pixels
+ * écrits sont comptés comme ceux de 'my_mlx_pixel_put'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param k La colonne, dont 'count' est déjà fixé.
+ * @param x La colonne d'écran.
+ * @param y La ligne du premier pixel écrit.
+ */
+static void	column_target(t_Cub3d *cub, t_Column *k, int x, int y)
+{
+	if (cub->view)
+	{
+		k->dst = (unsigned int *)(cub->view->addr + x * cub->view->len) + y;
+		k->pitch = 1;
+		cub->view->writes += k->count;
+		return ;
+	}
+	k->dst = (unsigned int *)(cub->img->addr + y * cub->img->len) + x;
+	k->pitch = cub->img->len / 4;
+	cub->img->writes += k->count;
+}
+
+/**
+ * @brief Choisit le noyau spécialisé d'une colonne.
+ *
+ * Le choix est fait une fois par colonne, dans une table: avec ou sans
+ * table de lignes, reboucle par masque ou par modulo, face ombrée ou non.
+ * Les colonnes indexées ont leurs propres noyaux, où l'ombrage est toujours
+ * une lecture dans la table d'ombrage.
+ *
+ * @param k La colonne à dessiner.
+ * @return Le noyau qui dessine la colonne.
+ */
+static t_ColumnFn	column_kernel(t_Column *k)
+{
+	static const t_ColumnFn	kernels[6] = {col_gather_flat, col_gather_shade,
+		col_step_pow2_flat, col_step_pow2_shade, col_step_any_flat,
+		col_step_any_shade};
+	static const t_ColumnFn	indexed[3] = {col_index_gather, col_index_pow2,
+		col_index_any};
+	int						i;
+
+	i = 0;
+	if (!k->rows && (k->wrap & (k->wrap - 1)))
+		i = 2;
+	else if (!k->rows)
+		i = 1;
+	if (k->cmap)
+		return (indexed[i]);
+	return (kernels[2 * i + (k->shade != 0)]);
+}
+
+/**
+ * @brief Texture une colonne de mur avec un noyau spécialisé.
+ *
+ * Les noyaux ne traitent que des pixels de 32 bits, dans la texture comme
+ * dans l'image du jeu: les adresses, le pas et l'ombrage sont résolus ici,
+ * une fois par colonne. Les murs qui tiennent dans la vue lisent la table de
+ * lignes de texture de leur hauteur; les autres avancent pas à pas, avec le
+ * même calcul en 'float' que 'apply_texture'. Avec '--indexed', les texels
+ * sont lus dans la texture indexée de l'atlas.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param c Pointeur vers la configuration de la caméra, 'tex_x' rempli.
+ * @param img La texture du mur.
+ * @param x La colonne d'écran en cours de traitement.
+ * @return 1 si la colonne a été dessinée, 0 si les pixels ne font pas 32
+ * bits.
+ */
+int	texture_column(t_Cub3d *cub, t_CameraConfig *c, t_ImageControl *img,
+		int x)
+{
+	t_Scaler	*s;
+	t_Column	k;
+
+	if (img->bpp != 32 || cub->img->bpp != 32 || img->height < 2)
+		return (0);
+	k.count = c->draw_end - c->draw_start;
+	if (k.count <= 0)
+		return (1);
+	s = scaler_get(cub->scaler, c, img);
+	k.rows = NULL;
+	if (s)
+		k.rows = s->rows;
+	column_source(cub, c, img, &k);
+	k.step = 1.0 * img->width / c->line_height;
+	k.pos = (c->draw_start - c->height / 2 + c->line_height) * k.step;
+	k.wrap = img->height / 2;
+	column_target(cub, &k, x, c->draw_start + 1);
+	column_kernel(&k)(&k);
+	cub->atlas->reads += k.count;
+	return (1);
+}
@@ -0,0 +1,110 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Indique si la vue de la simulation diffère de la dernière frame
+ * rendue.
+ *
+ * Sont comparés la position, la direction et le plan de la caméra, l'image
+ * de l'animation du pistolet et le compteur des changements de porte:
+ * c'est tout ce que le rendu lit de la simulation.
+ *
+ * @param a L'état de la dernière frame rendue.
+ * @param b La vue courante de la simulation.
+ * @return 1 si la vue a changé, 0 sinon.
+ */
+static int	view_changed(t_SimState *a, t_SimState *b)
+{
+	return (a->pos_x != b->pos_x || a->pos_y != b->pos_y
+		|| a->dir_x != b->dir_x || a->dir_y != b->dir_y
+		|| a->plane_x != b->plane_x || a->plane_y != b->plane_y
+		|| a->gun_frame != b->gun_frame || a->doors != b->doors);
+}
+
+/**
+ * @brief Indique si la frame courante doit être rendue.
+ *
+ * Une frame est rendue si la vue de la simulation a changé depuis la
+ * dernière frame rendue, si un rendu est demandé ('cub->redraw': fenêtre
+ * exposée ou redimensionnée, overlay ou carte de chaleur changés) ou si une
+ * nouvelle taille de fenêtre attend. L'overlay du profileur affiche des
+ * durées qui changent à chaque frame, et la capture et la relecture
+ * comptent les frames: avec eux, toutes les frames sont rendues.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 1 si la frame doit être rendue, 0 si l'image affichée est à jour.
+ */
+int	frame_dirty(t_Cub3d *cub)
+{
+	if (cub->capture || (cub->replay && cub->replay->mode == REPLAY_PLAY))
+		cub->redraw = true;
+	if (!cub->redraw && !cub->win->resize_w && !cub->prof->overlay
+		&& !view_changed(&cub->drawn, &cub->sim->view))
+		return (0);
+	cub->drawn = cub->sim->view;
+	cub->redraw = false;
+	return (1);
+}
+
+/**
+ * @brief Oublie les mesures d'une frame qui n'est pas rendue.
+ *
+ * Les durées et les compteurs matériels des étapes ouvertes depuis la
+ * dernière frame rendue (PROF_FRAME, simulation) sont remis à zéro, pour
+ * que la prochaine frame rendue ne mesure que son propre travail.
+ *
+ * @param p Pointeur vers le profileur.
+ */
+static void	idle_reset(t_Profiler *p)
+{
+	int	i;
+
+	i = 0;
+	while (i < PROF_STAGES)
+		p->stage[i++].cur = 0;
+	if (p->perf)
+		ft_bzero(p->perf->cur, sizeof(p->perf->cur));
+}
+
+/**
+ * @brief Termine une frame qui n'est pas rendue.
+ *
+ * L'étape PROF_FRAME est fermée sans clore la frame dans le profileur, et
+ * les mesures de la frame sont oubliées ('idle_reset'): une frame sautée
+ * ne compte ni dans la fenêtre glissante ni dans le fichier CSV. Sans
+ * limite de FPS, le processus dort ensuite jusqu'au prochain événement X ou
+ * au prochain tick de la simulation; avec une limite, 'frame_ready' dort
+ * déjà jusqu'à l'échéance de la frame suivante.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return renvoie toujours 0.
+ */
+int	frame_idle(t_Cub3d *cub)
+{
+	int	ms;
+
+	prof_end(cub->prof, PROF_FRAME);
+	idle_reset(cub->prof);
+	if (cub->clock->target_ns)
+		return (0);
+	ms = cub->sim->tick_ns / 1000000;
+	if (ms < 1)
+		ms = 1;
+	mlx_wait_event(cub->mlx_ptr, ms);
+	return (0);
+}
+
+/**
+ * @brief Demande le rendu de la fenêtre quand elle est exposée.
+ *
+ * Le serveur X ne garde pas le contenu d'une fenêtre recouverte: quand
+ * elle redevient visible (événement Expose), la frame ou le menu sont
+ * redessinés même si rien n'a changé.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return renvoie toujours 0.
+ */
+int	on_window_expose(t_Cub3d *cub)
+{
+	cub->redraw = true;
+	return (0);
+}
@@ -0,0 +1,93 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Vérifie que la texture d'un matériau est un fichier .xpm lisible.
+ *
+ * @param path Le chemin de la texture.
+ * @return 0 si le fichier est valide, 1 sinon.
+ */
+static int	xpm_file(char *path)
+{
+	int	len;
+	int	fd;
+
+	len = ft_strlen(path);
+	if (len < 4 || ft_strncmp(path + len - 4, ".xpm", 5))
+		return (1);
+	fd = open(path, O_RDONLY);
+	if (fd < 0)
+		return (1);
+	close(fd);
+	return (0);
+}
+
+/**
+ * @brief Vérifie les textures des matériaux déclarés et prépare leurs
+ * images.
+ *
+ * Équivalent de 'check_tex_validity' pour les matériaux: chaque texture
+ * déclarée doit être un fichier .xpm accessible.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 si une texture est invalide ou si
+ * l'allocation échoue.
+ */
+int	check_materials(t_Cub3d *cub)
+{
+	t_TextureSetup	*t;
+	int				i;
+
+	i = 0;
+	while (i < MAT_COUNT)
+	{
+		t = cub->map->tex_mat[i++];
+		if (t)
+		{
+			t->img = ft_calloc(1, sizeof(t_ImageControl));
+			if (!t->img || xpm_file(t->path))
+				return (1);
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Charge les textures des matériaux déclarés et résout l'adresse de
+ * leurs pixels.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	load_materials(t_Cub3d *cub)
+{
+	t_TextureSetup	*t;
+	int				i;
+
+	i = 0;
+	while (i < MAT_COUNT)
+	{
+		t = cub->map->tex_mat[i++];
+		if (t)
+		{
+			load_xpm(cub, t->img, t->path);
+			t->img->addr = mlx_get_data_addr(t->img->img_ptr, &t->img->bpp,
+					&t->img->len, &t->img->endian);
+		}
+	}
+}
+
+/**
+ * @brief Libère les textures des matériaux.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	free_materials(t_Cub3d *cub)
+{
+	int	i;
+
+	i = 0;
+	while (i < MAT_COUNT)
+	{
+		free_textures(cub, cub->map->tex_mat[i]);
+		cub->map->tex_mat[i++] = NULL;
+	}
+}
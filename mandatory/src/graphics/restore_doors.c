@@ -1,12 +1,13 @@
 #include "../../headers/cub3d.h"
 
 /**
- * @brief Restaure une porte dans la matrice de la carte.
+ * @brief Restaure une porte dans la carte de la simulation.
  *
- * La fonction 'restore' vérifie si la position spécifiée dans la matrice de
- * la carte contient un '0' et si la position du joueur est suffisamment éloignée
+ * La fonction 'restore' vérifie si la position spécifiée dans la carte de la
+ * simulation ('world') contient un '0' et si la position du joueur est suffisamment éloignée
  * de celle-ci. Si ces conditions sont remplies, il modifie la valeur de la carte à
- * '9', rétablissant effectivement cette position.
+ * '9', rétablissant effectivement cette position, et compte le changement
+ * dans 'door_changes'.
  *
  * @param cub Pointeur vers la structure de configuration principale du jeu Cub3D.
  * @param x La coordonnée x dans la matrice de la carte.
@@ -14,46 +15,14 @@
  */
 static void	restore(t_Cub3d *cub, int x, int y)
 {
-	if (cub->map->matrix[y][x] == '0'
+	if (cub->map->world[y][x] == '0'
 		&& (cub->player->pos_y > y + 3 || cub->player->pos_y < y - 3
 			|| cub->player->pos_x > x + 3
 			|| cub->player->pos_x < x - 3))
-		cub->map->matrix[y][x] = '9';
-}
-
-/**
- * @brief Compter les onglets dans une ligne et calculer la position horizontale.
- *
- * La fonction 'count_tabs' compte le nombre d'onglets dans une ligne et calcule la position
- * horizontale (x) en fonction du nombre d'onglets. Il réinitialise également le nombre de
- * tabulations à 0 après le traitement des tabulations. Cette fonction est généralement utilisée
- * pour suivre les positions horizontales dans une ligne contenant des onglets.
- *
- * @param line Une chaîne représentant une ligne de texte.
- * @param i L'index courant dans la ligne.
- * @param tabs Un pointeur vers un entier stockant le nombre de tabulations.
- * @return la position horizontale (x) calculée en fonction du nombre de tabulations.
- */
-static int	count_tabs(char *line, int i, int *tabs)
-{
-	int	x;
-
-	x = 0;
-	(*tabs)++;
-	if (line[i] == '\t')
 	{
-		if (*tabs == 7)
-			(*tabs) = 0;
-		while (*tabs < 8)
-		{
-			x++;
-			(*tabs)++;
-		}
-		*tabs = 0;
+		cub->map->world[y][x] = '9';
+		cub->map->door_changes++;
 	}
-	else if (*tabs == 7)
-		(*tabs) = 0;
-	return (x);
 }
 
 /**
@@ -82,9 +51,10 @@ int	check_walls_doors(t_MapConfig *m, int i, int j)
 				|| ft_strchr("NSEW", m->matrix[i][j - 1]))
 				&& (m->matrix[i][j + 1] == '0'
 				|| ft_strchr("NSEW", m->matrix[i][j + 1]))
-				&& m->matrix[i - 1][j] == '1' && m->matrix[i + 1][j] == '1')
+				&& is_wall(m->matrix[i - 1][j]) && is_wall(m->matrix[i + 1][j]))
 				return (0);
-			else if (m->matrix[i][j - 1] == '1' && m->matrix[i][j + 1] == '1'
+			else if (is_wall(m->matrix[i][j - 1])
+				&& is_wall(m->matrix[i][j + 1])
 				&& (m->matrix[i - 1][j] == '0'
 				|| ft_strchr("NSEW", m->matrix[i - 1][j]))
 				&& (m->matrix[i + 1][j] == '0'
@@ -100,43 +70,76 @@ int	check_walls_doors(t_MapConfig *m, int i, int j)
 }
 
 /**
- * @brief Restaure les tuiles de porte sur la carte si des conditions spécifiques sont remplies.
+ * @brief Parcourt la matrice de la carte à la recherche des portes.
  *
- * La fonction 'restore_doors' scanne la carte à la recherche de tuiles de porte ('9')
- * et les restaure à leur état d'origine sous certaines conditions. Une porte peut être
- * restaurée si elle a déjà été ouverte ('0') et que le personnage joueur n'est pas à proximité.
- * La fonction lit les données cartographiques à partir d'un fichier temporaire et vérifie l'éligibilité
- * de chaque carreau de porte à la restauration.
- *
- * @param cub Pointeur vers la structure t_Cub3d.
- * @param x La coordonnée x initiale pour scanner la carte.
- * @param y La coordonnée y initiale pour scanner la carte.
+ * @param m Pointeur vers la structure de configuration de la carte.
+ * @param doors La table qui reçoit la position de chaque porte, ou NULL
+ * pour seulement les compter.
+ * @return Le nombre de tuiles de porte ('9') de la carte.
  */
-void	restore_doors(t_Cub3d *cub, int x, int y, int i)
+static int	door_scan(t_MapConfig *m, t_Door *doors)
 {
-	char	*line;
-	int		tabs;
+	int	n;
+	int	x;
+	int	y;
 
-	tabs = 0;
-	cub->map->temp_fd = open("./.map", O_RDONLY);
-	line = get_next_line(cub->map->temp_fd);
-	if (!line)
-		return ;
-	while (line)
+	n = 0;
+	y = -1;
+	while (++y <= m->n_lines)
 	{
-		x = 0;
-		i = 0;
-		tabs = 0;
-		while (line[i])
+		x = -1;
+		while (m->matrix[y][++x])
 		{
-			x += count_tabs(line, i, &tabs);
-			if (line[i] == '9')
-				restore(cub, x, y);
-			x++;
-			i++;
+			if (m->matrix[y][x] == '9' && doors)
+			{
+				doors[n].x = x;
+				doors[n].y = y;
+			}
+			if (m->matrix[y][x] == '9')
+				n++;
 		}
-		y++;
-		free(line);
-		line = get_next_line(cub->map->temp_fd);
 	}
-}
\ No newline at end of file
+	return (n);
+}
+
+/**
+ * @brief Construit la table des portes de la carte.
+ *
+ * La fonction 'init_doors' compte d'abord les tuiles de porte ('9') de la
+ * matrice, alloue la table 'cub->map->doors' à leur nombre, puis y
+ * enregistre la position de chaque porte. La simulation peut ensuite
+ * vérifier les portes à chaque tick sans relire le fichier de carte.
+ *
+ * @param m Pointeur vers la structure de configuration de la carte.
+ * @return 0 en cas de succès, 1 si l'allocation de la table échoue.
+ */
+int	init_doors(t_MapConfig *m)
+{
+	m->n_doors = 0;
+	m->doors = ft_calloc(door_scan(m, NULL) + 1, sizeof(t_Door));
+	if (!m->doors)
+		return (1);
+	m->n_doors = door_scan(m, m->doors);
+	return (0);
+}
+
+/**
+ * @brief Referme les portes ouvertes dont le joueur s'est éloigné.
+ *
+ * La fonction 'restore_doors' parcourt la table des portes construite par
+ * 'init_doors' et referme chaque porte ouverte ('0') lorsque le joueur n'est
+ * plus à proximité. Elle est appelée à chaque tick de la simulation.
+ *
+ * @param cub Pointeur vers la structure t_Cub3d.
+ */
+void	restore_doors(t_Cub3d *cub)
+{
+	int	i;
+
+	i = 0;
+	while (i < cub->map->n_doors)
+	{
+		restore(cub, cub->map->doors[i].x, cub->map->doors[i].y);
+		i++;
+	}
+}
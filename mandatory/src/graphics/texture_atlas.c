@@ -0,0 +1,140 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie la texture chargée d'une entrée de l'atlas.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param slot L'entrée de l'atlas: faces nord, sud, ouest et est, porte,
+ * puis matériaux.
+ * @return La texture chargée par MiniLibX, ou NULL si l'entrée n'a pas de
+ * texture (porte hors bonus, matériau non déclaré).
+ */
+static t_ImageControl	*atlas_source(t_Cub3d *cub, int slot)
+{
+	if (slot < ATLAS_DOOR)
+		return (get_img_struct(cub, slot + 1));
+	if (slot == ATLAS_DOOR && BONUS)
+		return (get_img_struct(cub, 9));
+	if (slot >= ATLAS_MAT && cub->map->tex_mat[slot - ATLAS_MAT])
+		return (cub->map->tex_mat[slot - ATLAS_MAT]->img);
+	return (NULL);
+}
+
+/**
+ * @brief Renvoie la place d'une texture dans l'atlas.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param img La texture chargée.
+ * @return Sa taille sans remplissage de fin de ligne, à 4 octets par texel
+ * ou à 1 avec '--indexed', arrondie au multiple de ATLAS_ALIGN supérieur;
+ * 0 si ses pixels ne font pas 32 bits.
+ */
+static long long	atlas_size(t_Cub3d *cub, t_ImageControl *img)
+{
+	long long	size;
+
+	if (!img || img->bpp != 32)
+		return (0);
+	size = (long long)img->width * img->height;
+	if (!cub->opt->indexed)
+		size *= 4;
+	return ((size + ATLAS_ALIGN - 1) / ATLAS_ALIGN * ATLAS_ALIGN);
+}
+
+/**
+ * @brief Recopie une texture dans l'atlas, ligne par ligne.
+ *
+ * Une texture dont les pixels ne font pas 32 bits n'est pas recopiée:
+ * l'entrée décrit alors l'image de MiniLibX, pour le calcul par pixel de
+ * 'apply_texture'. Avec '--indexed', l'entrée décrit aussi l'image de
+ * MiniLibX et l'atlas ne reçoit que les index de la texture, écrits par
+ * 'palette_build'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param slot L'entrée de l'atlas.
+ * @param src La texture chargée.
+ * @param addr L'adresse de la texture dans l'atlas, alignée.
+ */
+static void	atlas_copy(t_Cub3d *cub, int slot, t_ImageControl *src,
+		char *addr)
+{
+	t_ImageControl	*dst;
+	int				y;
+
+	dst = &cub->atlas->tex[slot];
+	*dst = *src;
+	dst->writes = 0;
+	if (src->bpp != 32)
+		return ;
+	if (cub->opt->indexed)
+	{
+		cub->atlas->index[slot] = (unsigned char *)addr;
+		return ;
+	}
+	dst->img_ptr = NULL;
+	dst->addr = addr;
+	dst->len = src->width * 4;
+	y = 0;
+	while (y < src->height)
+	{
+		ft_memcpy(addr + y * dst->len, src->addr + y * src->len, dst->len);
+		y++;
+	}
+}
+
+/**
+ * @brief Construit l'atlas des textures des murs, des portes et des
+ * matériaux.
+ *
+ * Les textures chargées sont recopiées dans un seul bloc, chacune à une
+ * adresse alignée sur ATLAS_ALIGN octets. Le texturage des murs lit ensuite
+ * l'entrée de l'atlas du mur touché ('wall_tex') au lieu de chercher la
+ * texture de la face. Avec '--indexed', l'atlas est ensuite indexé sur une
+ * palette ('palette_build').
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation.
+ */
+int	atlas_build(t_Cub3d *cub)
+{
+	t_Atlas		*a;
+	long long	off;
+	int			i;
+
+	cub->atlas = ft_calloc(1, sizeof(t_Atlas));
+	a = cub->atlas;
+	if (!a)
+		return (1);
+	i = 0;
+	while (i < ATLAS_SLOTS)
+		a->bytes += atlas_size(cub, atlas_source(cub, i++));
+	a->base = malloc(a->bytes + ATLAS_ALIGN);
+	if (!a->base)
+		return (1);
+	off = ATLAS_ALIGN - (unsigned long)a->base % ATLAS_ALIGN;
+	i = 0;
+	while (i < ATLAS_SLOTS)
+	{
+		if (atlas_source(cub, i))
+			atlas_copy(cub, i, atlas_source(cub, i), a->base + off);
+		off += atlas_size(cub, atlas_source(cub, i++));
+	}
+	if (cub->opt->indexed)
+		return (palette_build(cub));
+	return (0);
+}
+
+/**
+ * @brief Libère l'atlas des textures et sa palette.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	atlas_free(t_Cub3d *cub)
+{
+	if (!cub->atlas)
+		return ;
+	free(cub->atlas->base);
+	free(cub->atlas->pal);
+	free(cub->atlas);
+	cub->atlas = NULL;
+}
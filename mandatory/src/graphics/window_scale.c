@@ -0,0 +1,117 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Réalloue les tables des impacts et des directions de rayon.
+ *
+ * Les anciennes tables ne sont libérées que si les deux nouvelles ont pu
+ * être allouées; la table des directions sera recalculée à la prochaine
+ * frame.
+ *
+ * @param cam Pointeur vers la configuration de la caméra.
+ * @param width La nouvelle largeur de la fenêtre.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation.
+ */
+static int	resize_tables(t_CameraConfig *cam, int width)
+{
+	t_RayHit	*hits;
+	t_RayDir	*rays;
+
+	hits = ft_calloc(width, sizeof(t_RayHit));
+	rays = ft_calloc(width, sizeof(t_RayDir));
+	if (!hits || !rays)
+	{
+		free(hits);
+		free(rays);
+		return (1);
+	}
+	free(cam->hits);
+	free(cam->rays);
+	cam->hits = hits;
+	cam->rays = rays;
+	cam->rays_w = 0;
+	return (0);
+}
+
+/**
+ * @brief Applique la taille reçue par 'on_window_configure'.
+ *
+ * L'image du jeu est recréée à chaque frame par 'cub3d_new_image', à la
+ * taille de la fenêtre: seules les tables des impacts et des directions de
+ * rayon sont réallouées. Si cette allocation échoue, ou pendant une capture
+ * dont les frames ont une taille fixe, la fenêtre garde l'ancienne taille
+ * de rendu. Le menu est effacé pour être redessiné au nouveau centre de la
+ * fenêtre.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	window_resize(t_Cub3d *cub)
+{
+	t_WindowConfig	*w;
+
+	w = cub->win;
+	if (!cub->opt->capture && !resize_tables(cub->cam, w->resize_w))
+	{
+		w->width = w->resize_w;
+		w->height = w->resize_h;
+		window_set_scale(w, w->scale);
+		cub->redraw = true;
+		if (cub->menu_active)
+			mlx_clear_window(cub->mlx_ptr, cub->win_ptr);
+	}
+	w->resize_w = 0;
+}
+
+/**
+ * @brief Ajuste la résolution de la vue 3D à la durée des frames.
+ *
+ * La durée de la dernière frame (étape PROF_FRAME du profileur, sans
+ * l'attente de l'échéance) est lissée sur SCALE_SMOOTH frames. Toutes les
+ * SCALE_PERIOD frames, la résolution baisse de SCALE_STEP % si la moyenne
+ * dépasse le budget, et monte de SCALE_STEP % si la durée prévue à la
+ * résolution supérieure, proportionnelle au nombre de pixels, reste sous
+ * SCALE_HEADROOM fois le budget. La moyenne est corrigée de la même façon
+ * à chaque changement, pour ne pas attendre qu'elle se stabilise.
+ *
+ * @param w Pointeur vers la configuration de la fenêtre.
+ * @param p Pointeur vers le profileur.
+ */
+static void	dynamic_scale(t_WindowConfig *w, t_Profiler *p)
+{
+	long long	last;
+	double		ratio;
+	int			old;
+
+	if (!w->budget_ns || !p->count)
+		return ;
+	last = p->stage[PROF_FRAME].ring[(p->head + PROF_WINDOW - 1)
+		% PROF_WINDOW];
+	if (!w->avg_ns)
+		w->avg_ns = last;
+	w->avg_ns += (last - w->avg_ns) / SCALE_SMOOTH;
+	if (++w->frames < SCALE_PERIOD)
+		return ;
+	old = w->scale;
+	ratio = (old + SCALE_STEP) / (double)old;
+	if (w->avg_ns > w->budget_ns)
+		window_set_scale(w, old - SCALE_STEP);
+	else if (w->avg_ns * ratio * ratio < w->budget_ns * SCALE_HEADROOM)
+		window_set_scale(w, old + SCALE_STEP);
+	ratio = w->scale / (double)old;
+	w->avg_ns *= ratio * ratio;
+}
+
+/**
+ * @brief Prépare la fenêtre pour la frame suivante.
+ *
+ * Appelée par 'render_frame' avant le rendu: applique une nouvelle taille de
+ * fenêtre, puis ajuste la résolution de la vue 3D si '--frame-budget' est
+ * donné.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	window_update(t_Cub3d *cub)
+{
+	if (cub->win->resize_w)
+		window_resize(cub);
+	dynamic_scale(cub->win, cub->prof);
+}
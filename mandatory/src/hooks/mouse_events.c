@@ -8,19 +8,15 @@
  * et le réticule du joueur sur la fenêtre de jeu. Cette fonction est
  * généralement appelée lorsque le jeu est démarré pour la première fois
  * ou après être revenu du menu principal pour afficher le monde du jeu au joueur.
+ * Elle démarre également la simulation à pas fixe.
  *
  * Pointeur @param cub vers la structure t_Cub3d .
  */
 static void	draw_first_frame(t_Cub3d *cub)
 {
-	draw_rays(cub);
-	draw_minimap(cub);
-	draw_gun(cub, cub->player, 0, 0);
-	draw_crosshair(cub, cub->player, 0, 0);
-	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
-		cub->img->img_ptr, 0, 0);
-	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
-		cub->minimap->img->img_ptr, 30, 30);
+	sim_start(cub, cub->opt->sim_thread);
+	sim_view(cub);
+	render_frame(cub);
 	cub->menu_active = false;
 }
 
@@ -33,7 +29,8 @@ static void	draw_first_frame(t_Cub3d *cub)
  * et déclenche des actions en conséquence. Si le menu du jeu est actif et que le
  * bouton "start" est cliqué, il affiche la première image du jeu.
  * Si le bouton "Quit" est cliqué, il ferme la fenêtre du jeu. Si le menu
- * n'est pas actif, il signale au joueur d'effectuer une action de tir.
+ * n'est pas actif, il demande un tir, que la simulation applique au tick
+ * suivant.
  *
  * touche @ param Le bouton de la souris qui a été enfoncé.
  * @param x La coordonnée x du curseur de la souris.
@@ -46,12 +43,12 @@ int	mouse_hook(int key, int x, int y, t_Cub3d *cub)
 	int	start;
 	int	quit;
 
-	(void)x;
-	(void)y;
 	start = 0;
 	quit = 0;
 	if (cub->menu_active && key == 1)
 	{
+		cub->mouse_x = x;
+		cub->mouse_y = y;
 		start = button_mo(cub, cub->main->start->img, 's');
 		quit = button_mo(cub, cub->main->quit->img, 'q');
 		if (start)
@@ -60,74 +57,67 @@ int	mouse_hook(int key, int x, int y, t_Cub3d *cub)
 			win_close(cub);
 	}
 	else
-		cub->player->shoot = 1;
+		atomic_fetch_or(&cub->sim->input, INPUT_SHOOT);
 	return (0);
 }
 
 /**
- * @brief Fait pivoter la vue du joueur et la direction de la caméra en fonction d'un angle donné.
+ * @brief poignée mouvement de la souris.
  *
- * La fonction 'rotate_player' calcule la nouvelle direction du joueur et du plan de la caméra
- * après avoir appliqué la rotation spécifiée par le paramètre 'angle'. Il met à jour la direction
- * du joueur et le plan de la caméra dans le contexte du jeu (`cub`) en conséquence.
+ * La fonction 'on_mouse_move' est appelée par MiniLibX à chaque événement
+ * MotionNotify, sans aller-retour avec le serveur X. Elle mémorise la position
+ * du pointeur (utilisée par le menu) et, en jeu, ajoute le déplacement
+ * horizontal à 'cub->sim->mouse_dx', que la simulation consomme au tick
+ * suivant avec 'apply_mouse_look'. Quand le pointeur atteint un bord de la
+ * fenêtre, il est replacé au centre; l'événement généré par ce déplacement
+ * est reconnu grâce à 'mouse_warp' et ignoré.
  *
+ * @param x La coordonnée x du pointeur dans la fenêtre.
+ * @param y La coordonnée y du pointeur dans la fenêtre.
  * @param cub Pointeur vers la structure 't_Cub3d'.
- * @param angle L'angle de rotation de la vue du joueur.
+ * @return renvoie toujours 0.
  */
-static void	rotate_player(t_Cub3d *cub, double angle)
+int	on_mouse_move(int x, int y, t_Cub3d *cub)
 {
-	t_PlayerConfig	*p;
-	t_CameraConfig	*c;
-	t_Transform		rot_dir;
-	t_Transform		rot_plane;
-
-	c = cub->cam;
-	p = cub->player;
-	rot_dir.x = p->dir_x * cos(angle) - p->dir_y * sin(angle);
-	rot_dir.y = p->dir_x * sin(angle) + p->dir_y * cos(angle);
-	p->dir_x = rot_dir.x;
-	p->dir_y = rot_dir.y;
-	rot_plane.x = c->plane_x * cos(angle) - c->plane_y * sin(angle);
-	rot_plane.y = c->plane_x * sin(angle) + c->plane_y * cos(angle);
-	c->plane_x = rot_plane.x;
-	c->plane_y = rot_plane.y;
+	if (cub->mouse_warp && x == cub->win->width / 2
+		&& y == cub->win->height / 2)
+	{
+		cub->mouse_warp = false;
+		cub->mouse_x = x;
+		cub->mouse_y = y;
+		return (0);
+	}
+	if (!cub->menu_active)
+		atomic_fetch_add(&cub->sim->mouse_dx, x - cub->mouse_x);
+	cub->mouse_x = x;
+	cub->mouse_y = y;
+	if (!cub->menu_active && !cub->mouse_warp
+		&& (x < 1 || x >= cub->win->width - 1))
+	{
+		mlx_mouse_move(cub->mlx_ptr, cub->win_ptr, cub->win->width / 2,
+			cub->win->height / 2);
+		cub->mouse_warp = true;
+	}
+	return (0);
 }
 
 /**
- * @brief poignée mouvement de la souris et rotation de la caméra.
+ * @brief Applique la rotation de la souris accumulée depuis le dernier tick.
  *
- * La fonction 'on_mouse_move' est responsable de la mise à jour de l'orientation
- * de la caméra en fonction du mouvement de la souris. Il calcule le changement de
- * position de la souris ('mouse_x_diff'), gère le débordement de la souris sur
- * les bords de l'écran et ajuste la rotation de la caméra en conséquence.
- * Cette fonction garantit une rotation fluide et continue de la caméra même lorsque
- * le curseur de la souris atteint les limites de l'écran.
+ * La fonction 'apply_mouse_look' fait pivoter le joueur du déplacement de la
+ * souris attribué au tick courant ('look_dx'), récupéré par 'sim_input' ou
+ * relu depuis un enregistrement. Elle est appelée par la simulation, qui est
+ * la seule à modifier la direction du joueur. Le cosinus et le sinus de
+ * l'angle ne sont calculés qu'une fois par tick.
  *
  * @param cub Pointeur vers la structure 't_Cub3d'.
- * @return 0 si la caméra est tournée, 1 s'il n'y a pas de mouvement de la souris.
  */
-int	on_mouse_move(t_Cub3d *cub)
+void	apply_mouse_look(t_Cub3d *cub)
 {
-	int		temp_x;
-	int		mouse_x_diff;
-	int		overflow;
+	double	angle;
 
-	temp_x = cub->mouse_x;
-	mlx_mouse_get_pos(cub->mlx_ptr, cub->win_ptr, &cub->mouse_x, &cub->mouse_y);
-	mouse_x_diff = cub->mouse_x - temp_x;
-	if (cub->mouse_x < 1)
-	{
-		overflow = -cub->mouse_x;
-		cub->mouse_x = WINDOW_X - overflow;
-		mlx_mouse_move(cub->mlx_ptr, cub->win_ptr, WINDOW_X - 1, cub->mouse_y);
-	}
-	else if (cub->mouse_x >= WINDOW_X - 1)
-	{
-		overflow = cub->mouse_x - (WINDOW_X - 1);
-		cub->mouse_x = overflow;
-		mlx_mouse_move(cub->mlx_ptr, cub->win_ptr, 0, cub->mouse_y);
-	}
-	if (mouse_x_diff)
-		return (rotate_player(cub, 0.002 * mouse_x_diff), 0);
-	return (1);
+	if (!cub->sim->look_dx)
+		return ;
+	angle = 0.002 * cub->sim->look_dx;
+	rotate_view(cub, cos(angle), sin(angle));
 }
\ No newline at end of file
@@ -1,23 +1,27 @@
 #include "../headers/cub3d.h"
 
 /**
- * @brief Gère l'événement de fermeture de la fenêtre dans le jeu Cub3D.
+ * @brief Exécute une étape du démarrage et la place dans la chronologie.
  *
- * La fonction win_close est responsable de la gestion de l'événement de fermeture de 
- * fenêtre dans l'application Cub3D. Lorsqu'il est déclenché, il effectue des opérations
- * de nettoyage en appelant la fonction free_main pour libérer les ressources allouées
- * et assurer un arrêt propre de l'application. De plus, il affiche un message indiquant
- * la fermeture de jeu. Le paramètre 'false' passé à la fonction d'arrêt indique que jeu
- * doit se terminer avec un statut réussi (EXIT_SUCCESS), l'empêchant de planter en raison
- * d'erreurs.
+ * Avec '--trace', le chargement de la carte ('map_init') et le démarrage
+ * graphique ('graphics') apparaissent dans la chronologie, avec le
+ * chargement de chaque texture XPM.
  *
- * @param cub Pointeur vers la structure t_Cub3d contenant les données du programme.
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param name L'étape: "map_init" ou "graphics".
+ * @return Le résultat de l'étape: 0 en cas de succès, 1 en cas d'échec.
  */
-int	win_close(t_Cub3d *cub)
+static int	init_stage(t_Cub3d *cub, char *name)
 {
-	free_main(cub);
-	printf("Closing CUB3D\n");
-	exit(EXIT_SUCCESS);
+	int	err;
+
+	trace_event(cub->trace, name, 'B', NULL);
+	if (!ft_strncmp(name, "map_init", 9))
+		err = map_init(cub, cub->opt->map_file);
+	else
+		err = graphics(cub);
+	trace_event(cub->trace, name, 'E', NULL);
+	return (err);
 }
 
 /**
@@ -26,10 +30,16 @@ int	win_close(t_Cub3d *cub)
 * La fonction d'initialisation est responsable de la configuration initiale
 * état du programme. Il effectue les tâches suivantes:
 *
-* 1. Vérifie le nombre d'arguments de ligne de commande et valide l'entrée.
+* 1. Analyse les options de la ligne de commande et valide l'entrée, puis
+* prépare la chronologie '--trace'.
 * 2. Initialise les paramètres de la carte en analysant le fichier de carte fourni.
-* 3. Tente d'initialiser le sous-système graphique à l'aide de MiniLibX.
-* 4. Gère les erreurs et arrête gracieusement le programme en cas d'échec.
+* 3. Tente d'initialiser le sous-système graphique à l'aide de MiniLibX (sans
+* serveur X en mode banc d'essai ou en relecture '--headless').
+* 4. Ouvre l'enregistrement ou la relecture des entrées, qui peut imposer
+* la fréquence de la simulation, et la capture des frames, puis initialise l'horloge de cadencement des
+* frames, la simulation à pas fixe, une fois la position de départ du joueur
+* connue, et le profileur.
+* 5. Gère les erreurs et arrête gracieusement le programme en cas d'échec.
 *
 * @param ac Le nombre d'arguments de ligne de commande.
 * @param av Un tableau de chaînes représentant les arguments de la ligne de commande.
@@ -37,18 +47,16 @@ int	win_close(t_Cub3d *cub)
 */
 static void	initialization(int ac, char **av, t_Cub3d *cub)
 {
-	if (ac != 2)
-	{
-		printf("Error: Please input exactly two arguments\n");
-		exit(EXIT_FAILURE);
-	}
-	if (map_init(cub, av[1]))
+	parse_options(cub, ac, av);
+	if (trace_init(cub))
+		usage_exit("fatal: t_Trace not created");
+	if (init_stage(cub, "map_init"))
 	{
 		free_main(cub);
 		printf("Error: Failed initializing map settings\n");
 		exit(EXIT_FAILURE);
 	}
-	if (graphics(cub))
+	if (init_stage(cub, "graphics"))
 	{
 		free_main(cub);
 		printf("Error: Failed booting graphics.\n");
@@ -56,13 +64,24 @@ static void	initialization(int ac, char **av, t_Cub3d *cub)
 		printf("\tPlease check the texture files, so they are XPM\n");
 		exit(EXIT_FAILURE);
 	}
+	if (replay_init(cub) || capture_init(cub)
+		|| frame_clock_init(cub, cub->opt->target_fps)
+		|| sim_init(cub, cub->opt->tick_rate) || prof_init(cub))
+	{
+		free_main(cub);
+		printf("Error: Failed initializing timing, replay or capture\n");
+		exit(EXIT_FAILURE);
+	}
 }
 
 /**
  * @brief Gérer les interactions avec le menu du jeu.
  *
  * Cette fonction vérifie si le curseur de la souris est sur les boutons "Start" et "Quit",
- * met à jour leur apparence et revient.
+ * met à jour leur apparence et revient. Une nouvelle taille de fenêtre est
+ * appliquée d'abord, pour que les boutons restent centrés. Les boutons ne
+ * sont redessinés que si leur survol a changé ou si un rendu est demandé
+ * ('cub->redraw').
  *
  * @param cub Pointeur vers la configuration principale du jeu Cub3D.
  */
@@ -71,8 +90,14 @@ static void	menu_loop(t_Cub3d *cub)
 	int	start;
 	int	quit;
 
+	if (cub->win->resize_w)
+		window_resize(cub);
 	start = button_mo(cub, cub->main->start->img, 's');
 	quit = button_mo(cub, cub->main->quit->img, 'q');
+	if (!cub->redraw && (start | quit << 1) == cub->menu_hover)
+		return ;
+	cub->menu_hover = start | quit << 1;
+	cub->redraw = false;
 	update_button(cub, cub->main->start->img, start, 's');
 	update_button(cub, cub->main->quit->img, quit, 'q');
 }
@@ -82,59 +107,54 @@ static void	menu_loop(t_Cub3d *cub)
  *
  * La fonction "gameloop" est le cœur de la boucle de jeu Cub3D.
  * Il effectue les actions suivantes:
+ * 0. Avec '--trace', termine le programme si SIGINT ou SIGTERM a été reçu
+ * ('trace_poll'). Attend l'échéance de la frame avec 'frame_ready', qui
+ * rend la main à MiniLibX dès qu'un événement arrive, puis démarre la
+ * frame avec 'frame_begin', qui mesure la durée de la frame précédente.
+ * Pendant la relecture d'un enregistrement, 'replay_step' fixe le nombre de
+ * ticks de la frame et termine le programme à la fin de l'enregistrement.
  * 1. Si le menu du jeu est actif ('cub- > menu_active') est vrai,
  * il appelle la fonction 'menu_loop' pour gérer les interactions et
  * les mises à jour du menu.
  * 2. Si le menu n'est pas actif, il procède à la logique principale
  * du jeu et au rendu:
- *		- Appelle la fonction 'readmove' pour gérer les mouvements du joueur.
- *		- Restaure les portes à leur état d'origine (le cas échéant) en utilisant
- * la fonction restore_doors. Cette fonction semble s'occuper de la restauration
- * de l'état du jeu.
- *		- Appelle 'cub3d_new_image' pour créer une nouvelle image pour la fenêtre
- * principale du jeu.
- *		- Appelle 'minimap_new_image' pour créer une nouvelle image pour la minimap.
- *		- Dessine la minimap en utilisant la fonction 'draw_minimap'.
- *		- Exécute le lancer de rayons et dessine la scène du jeu à l'aide
- * de la fonction ('draw_rays').
- *		- Rend l'arme du joueur en utilisant la fonction 'draw_gun'.
- *		- Rend le crosshair en utilisant la fonction 'draw_crosshair'.
- * 		- Place l'image principale du jeu et l'image de la minimap dans la fenêtre
- * du jeu à l'aide de la fonction `mlx_put_image_to_window`.
- * 		- Vérifie si le joueur tire ('cub->player->shoot') et met à jour l'animation
- * du pistolet à l'aide de la fonction 'shoot_gun'.
+ *		- Fait avancer la simulation à pas fixe avec 'sim_update' (mouvements
+ * du joueur, portes, animation du pistolet), puis calcule la pose interpolée
+ * utilisée par le rendu avec 'sim_view'.
+ *		- Si rien de ce que lit le rendu n'a changé ('frame_dirty'), la frame
+ * n'est ni rendue ni affichée et la boucle dort ('frame_idle').
+ *		- Met à jour le sprite du pistolet avec 'shoot_gun' si l'image de
+ * l'animation a changé.
+ *		- Rend et affiche la frame avec 'render_frame' (nouvelles images,
+ * minimap, lancer de rayons, pistolet, réticule et overlay du profileur).
  * 		- Désactive le menu du jeu (`cub->menu_active = false`) après le rendu.
- * 		- Si le joueur tire, il incrémente le compteur " pistolet`.
+ *		- Clôt la frame dans le profileur avec 'prof_frame_end'.
  *
  * @param cub Pointeur vers la structure de configuration principale du jeu Cub3D.
  * @return renvoie toujours 0.
  */
 int	gameloop(t_Cub3d *cub)
 {
-	static int	gun;
-
+	trace_poll(cub);
+	if (!frame_ready(cub))
+		return (0);
+	frame_begin(cub->clock);
 	if (cub->menu_active)
 	{
 		menu_loop(cub);
 		return (0);
 	}
-	readmove(cub, cub->player);
-	restore_doors(cub, 0, 0, 0);
-	cub3d_new_image(cub);
-	minimap_new_image(cub);
-	draw_minimap(cub);
-	draw_rays(cub);
-	draw_gun(cub, cub->player, 0, 0);
-	draw_crosshair(cub, cub->player, 0, 0);
-	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
-		cub->img->img_ptr, 0, 0);
-	mlx_put_image_to_window(cub->mlx_ptr, cub->win_ptr,
-		cub->minimap->img->img_ptr, 30, 30);
-	if (cub->player->shoot)
-		shoot_gun(cub, cub->player, &gun);
+	replay_step(cub);
+	prof_begin(cub->prof, PROF_FRAME);
+	sim_update(cub);
+	sim_view(cub);
+	if (!frame_dirty(cub))
+		return (frame_idle(cub));
+	shoot_gun(cub, cub->player, cub->sim->view.gun_frame);
+	render_frame(cub);
 	cub->menu_active = false;
-	if (cub->player->shoot)
-		gun++;
+	prof_end(cub->prof, PROF_FRAME);
+	prof_frame_end(cub->prof);
 	return (0);
 }
 
@@ -147,19 +167,18 @@ int	main(int ac, char **av, char **env)
 	t_Cub3d	cub;
 
 	(void)env;
-	cub.graphics_ok = false;
-	cub.files_ok = false;
-	cub.menu_active = false;
-	cub.minimap_ok = false;
-	cub.menu_ok = false;
-	cub.cam_ok = false;
-	cub.gun_ok = false;
+	ft_bzero(&cub, sizeof(t_Cub3d));
 	initialization(ac, av, &cub);
-	mlx_mouse_move(cub.mlx_ptr, cub.win_ptr, WINDOW_X / 2, WINDOW_Y / 2);
-	mlx_mouse_get_pos(cub.mlx_ptr, cub.win_ptr, &cub.mouse_x, &cub.mouse_y);
+	if (cub.opt->bench)
+		bench_run(&cub);
+	cub.mouse_x = cub.win->width / 2;
+	cub.mouse_y = cub.win->height / 2;
+	mlx_mouse_move(cub.mlx_ptr, cub.win_ptr, cub.mouse_x, cub.mouse_y);
+	cub.mouse_warp = true;
 	hook_events(&cub);
+	replay_start(&cub);
 	mlx_loop_hook(cub.mlx_ptr, &gameloop, &cub);
-	mlx_loop(cub.mlx_ptr);
+	mlx_loop_ex(cub.mlx_ptr, cub.opt->sync_policy, cub.opt->sync_every);
 	free_main(&cub);
 	printf("Closing CUB3D\n");
 	return (0);
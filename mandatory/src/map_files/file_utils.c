@@ -115,7 +115,8 @@ static char	*skip_info2(t_Cub3d *cub, char *line, int *skip)
  * Cette fonction est responsable de la lecture du fichier de carte et de l'omission des
  * lignes d'informations de carte initiales, telles que les chemins de texture et les paramètres
  * de couleur. Il continue à parcourir le fichier jusqu'à ce qu'il localise la première ligne de
- * données cartographiques réelles contenant "1" pour représenter les murs. Une fois la première
+ * données cartographiques réelles contenant un mur ("1" ou un matériau), en ignorant
+ * les déclarations de matériaux. Une fois la première
  * ligne de données cartographiques trouvée, la fonction renvoie un pointeur vers celle-ci, permettant
  * un traitement ultérieur de la disposition de la carte. La fonction utilise un compteur de sauts pour
  * garder une trace du nombre de lignes sautées pendant le processus.
@@ -141,9 +142,9 @@ char	*skip_info(t_Cub3d *cub, char *line, int i)
 	while (line)
 	{
 		i = 0;
-		while (line[i])
+		while (line[i] && is_material(line) < 0)
 		{
-			if (!ft_strncmp("1", &line[i], 1))
+			if (is_wall(line[i]))
 				return (line);
 			i++;
 		}
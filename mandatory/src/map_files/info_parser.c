@@ -109,7 +109,8 @@ int	has_valid_info2(t_Cub3d *cub, char *line)
  * fichier ligne par ligne jusqu'à ce qu'il trouve la section de la carte, puis il
  * vérifie que la carte ne contient que des caractères valides ('1' pour les murs,
  * ' 'pour les espaces vides et' \n ' pour les fins de ligne). Tout autre caractère
- * indique une carte non valide.
+ * indique une carte non valide. Les murs des matériaux ('2' à '8') valent '1', et
+ * les déclarations de matériaux avant la carte sont ignorées.
  *
  * @param line Un pointeur sur la ligne en cours de traitement.
  * @param fd Le descripteur de fichier du fichier de carte.
@@ -125,12 +126,12 @@ static int ft_check_d(char *line, int fd)
 	while (line)
 	{
 		i = 0;
-		while (line[i] && !is_map)
+		while (line[i] && !is_map && is_material(line) < 0)
 		{
-			if (line[i] != '1' && line[i] != ' '
+			if (!is_wall(line[i]) && line[i] != ' '
 				&& line[i] != '\t' && line[i] != '\n')
 				return (ft_clean_gnl(fd, line), 1);
-			if (line[i] == '1')
+			if (is_wall(line[i]))
 				is_map = true;
 			i++;
 		}
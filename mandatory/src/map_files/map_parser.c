@@ -62,7 +62,7 @@ static int	parse_elements2(t_Cub3d *cub, char *line, int i)
 	charset = "01NSEW\n\t ";
 	if (BONUS)
 		charset = "019NSEW\n\t ";
-	if (!ft_strchr(charset, line[i]))
+	if (!ft_strchr(charset, line[i]) && !material_cell(cub->map, line[i]))
 		return (1);
 	else if (set_player_orientation(cub, line[i]))
 		return (1);
@@ -157,7 +157,7 @@ int	check_map_validity(t_Cub3d *cub)
  */
 int	parse_map_file(t_Cub3d *cub)
 {
-	if (has_valid_info(cub, NULL))
+	if (has_valid_info(cub, NULL) || parse_materials(cub))
 	{
 		free_main(cub);
 		printf("Error: Invalid or missing texture/color info\n");
@@ -0,0 +1,95 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Reconnaît une ligne de l'en-tête qui déclare un matériau de mur.
+ *
+ * Une déclaration a la forme 'M2 chemin.xpm' à 'M8 chemin.xpm': le chiffre
+ * est celui des cellules de la carte qui utilisent la texture.
+ *
+ * @param line La ligne lue dans le fichier de la carte.
+ * @return L'index du matériau (0 pour '2'), ou -1 si la ligne n'en déclare
+ * pas.
+ */
+int	is_material(char *line)
+{
+	if (line[0] == 'M' && line[1] >= MAT_FIRST
+		&& line[1] < MAT_FIRST + MAT_COUNT
+		&& (line[2] == ' ' || line[2] == '\t'))
+		return (line[1] - MAT_FIRST);
+	return (-1);
+}
+
+/**
+ * @brief Enregistre le chemin de la texture d'un matériau.
+ *
+ * @param m Pointeur vers la configuration de la carte.
+ * @param line La ligne de déclaration du matériau.
+ * @param id L'index du matériau.
+ * @return 0 en cas de succès, 1 si le matériau est déjà déclaré, si le
+ * chemin est vide ou si l'allocation échoue.
+ */
+static int	set_material(t_MapConfig *m, char *line, int id)
+{
+	if (m->tex_mat[id])
+		return (1);
+	m->tex_mat[id] = ft_calloc(1, sizeof(t_TextureSetup));
+	if (!m->tex_mat[id])
+		return (1);
+	m->tex_mat[id]->path = ft_strtrim(line + 3, " \t\n");
+	if (!m->tex_mat[id]->path || !m->tex_mat[id]->path[0])
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Lit les déclarations de matériaux de l'en-tête de la carte.
+ *
+ * Les déclarations sont facultatives et peuvent se trouver n'importe où
+ * avant la carte; elles sont lues dans une passe à part, après les textures
+ * et les couleurs obligatoires.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 si une déclaration est invalide ou répétée.
+ */
+int	parse_materials(t_Cub3d *cub)
+{
+	char	*line;
+	int		id;
+
+	ft_open(cub);
+	line = get_next_line(cub->map->fd);
+	while (line)
+	{
+		id = is_material(line);
+		if (id >= 0 && set_material(cub->map, line, id))
+			return (ft_clean_gnl(cub->map->fd, line), 1);
+		free(line);
+		line = get_next_line(cub->map->fd);
+	}
+	close(cub->map->fd);
+	return (0);
+}
+
+/**
+ * @brief Vérifie qu'une cellule de la carte est un matériau déclaré.
+ *
+ * @param m Pointeur vers la configuration de la carte.
+ * @param c Le caractère de la cellule.
+ * @return 1 si la cellule est un mur d'un matériau déclaré, 0 sinon.
+ */
+int	material_cell(t_MapConfig *m, char c)
+{
+	return (c >= MAT_FIRST && c < MAT_FIRST + MAT_COUNT
+		&& m->tex_mat[c - MAT_FIRST]);
+}
+
+/**
+ * @brief Indique si une cellule de la carte est un mur: '1' ou un matériau.
+ *
+ * @param c Le caractère de la cellule.
+ * @return 1 si la cellule est un mur, 0 sinon.
+ */
+int	is_wall(char c)
+{
+	return (c >= '1' && c < MAT_FIRST + MAT_COUNT);
+}
@@ -48,18 +48,18 @@ void	draw_dynamic_map(t_Cub3d *cub, int temp_x, int temp_y)
 	int	x;
 	int	y;
 
-	y = (int)cub->player->pos_y - 5;
+	y = (int)cub->sim->view.pos_y - 5;
 	temp_y = y;
 	while (y < (temp_y + 11))
 	{
-		x = (int)cub->player->pos_x - 5;
+		x = (int)cub->sim->view.pos_x - 5;
 		temp_x = x;
 		while (x < (temp_x + 11))
 		{
 			if (y >= cub->map->n_lines + 1 || y < 0
 				|| x >= max_x_array(cub) || x < 0)
 				draw_dynamic_cube(cub, BLACK);
-			else if (ft_strchr("19 ", cub->map->matrix[y][x]))
+			else if (ft_strchr("123456789 ", cub->map->matrix[y][x]))
 				draw_dynamic_cube(cub, GREY);
 			else if (ft_strchr("0NSWE", cub->map->matrix[y][x]))
 				draw_dynamic_cube(cub, WHITE);
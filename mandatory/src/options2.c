@@ -0,0 +1,149 @@
+#include "../headers/cub3d.h"
+
+/**
+ * @brief Analyse une option du banc d'essai ou de l'enregistrement.
+ *
+ * La fonction 'parse_run_option' reconnaît les options qui changent le
+ * déroulement du programme: le banc d'essai hors écran ('--bench', '--path',
+ * '--frames'), l'enregistrement des entrées ('--record') et leur relecture
+ * ('--replay', '--replay-fast', '--headless'), la capture des frames
+ * ('--capture') et la comparaison aux images de référence ('--golden',
+ * '--golden-update'). Les autres options sont passées à
+ * 'parse_window_option'.
+ *
+ * @param o Pointeur vers les options à remplir.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'argument à analyser dans 'av'.
+ * @return L'index du dernier argument consommé.
+ */
+int	parse_run_option(t_Options *o, int ac, char **av, int i)
+{
+	if (!ft_strncmp(av[i], "--bench", 8))
+		o->bench = true;
+	else if (!ft_strncmp(av[i], "--path", 7) && i + 1 < ac)
+		o->bench_path = av[++i];
+	else if (!ft_strncmp(av[i], "--frames", 9))
+		o->bench_frames = option_value(ac, av, i++);
+	else if (!ft_strncmp(av[i], "--record", 9) && i + 1 < ac)
+		o->record = av[++i];
+	else if (!ft_strncmp(av[i], "--replay", 9) && i + 1 < ac)
+		o->replay = av[++i];
+	else if (!ft_strncmp(av[i], "--replay-fast", 14))
+		o->replay_fast = true;
+	else if (!ft_strncmp(av[i], "--headless", 11))
+		o->headless = true;
+	else if (!ft_strncmp(av[i], "--capture", 10) && i + 1 < ac)
+		o->capture = av[++i];
+	else if (!ft_strncmp(av[i], "--golden", 9) && i + 1 < ac)
+		o->golden = av[++i];
+	else if (!ft_strncmp(av[i], "--golden-update", 16))
+		o->golden_update = true;
+	else
+		i = parse_window_option(o, ac, av, i);
+	return (i);
+}
+
+/**
+ * @brief Vérifie la cohérence des options une fois toutes analysées.
+ *
+ * Le fichier de carte est obligatoire. '--golden' lance le banc d'essai, sur
+ * GOLDEN_POSES frames sauf si '--frames' est donné. Une partie ne peut pas
+ * être à la fois enregistrée et rejouée, ni rejouée pendant le banc d'essai;
+ * sans serveur X et sans relecture, personne ne pourrait quitter le menu.
+ * Les images de référence sont à la taille et à la résolution par défaut.
+ *
+ * @param o Pointeur vers les options analysées.
+ */
+void	check_options(t_Options *o)
+{
+	if (!o->map_file)
+		usage_exit("Please input a map file");
+	if (o->golden_update && !o->golden)
+		usage_exit("--golden-update needs --golden");
+	if (o->golden)
+		o->bench = true;
+	if (o->bench_frames < 0 && o->golden)
+		o->bench_frames = GOLDEN_POSES;
+	else if (o->bench_frames < 0)
+		o->bench_frames = BENCH_FRAMES;
+	if (!o->bench_frames)
+		usage_exit("--frames expects at least one frame");
+	if (o->record && o->replay)
+		usage_exit("--record and --replay can not be used together");
+	if (o->bench && (o->record || o->replay))
+		usage_exit("--bench can not record or replay inputs");
+	if ((o->replay_fast || o->headless) && !o->replay)
+		usage_exit("--replay-fast and --headless need --replay");
+	if (o->golden && (o->width || o->scale || o->frame_budget))
+		usage_exit("--golden can not change the window size or resolution");
+}
+
+/**
+ * @brief Lit la taille de fenêtre 'LARGEURxHAUTEUR' qui suit '--size'.
+ *
+ * @param o Pointeur vers les options à remplir.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ */
+static void	size_value(t_Options *o, int ac, char **av, int i)
+{
+	char	*x;
+
+	x = NULL;
+	if (i + 1 < ac)
+		x = ft_strchr(av[i + 1], 'x');
+	if (!x || !ft_isdigit(av[i + 1][0]) || !ft_isdigit(x[1]))
+		usage_exit("--size expects WIDTHxHEIGHT");
+	*x = '\0';
+	if (!ft_isnumeric(av[i + 1]) || !ft_isnumeric(x + 1))
+		usage_exit("--size expects WIDTHxHEIGHT");
+	o->width = ft_atoi(av[i + 1]);
+	o->height = ft_atoi(x + 1);
+	*x = 'x';
+	if (o->width < WINDOW_MIN_X || o->width > WINDOW_MAX_X
+		|| o->height < WINDOW_MIN_Y || o->height > WINDOW_MAX_Y)
+		usage_exit("--size must be between 800x600 and 7680x4320");
+}
+
+/**
+ * @brief Analyse une option de la fenêtre ou de la résolution de la vue.
+ *
+ * La fonction 'parse_window_option' reconnaît la taille de la fenêtre
+ * ('--size'), la résolution de la vue 3D en pourcentage de la fenêtre
+ * ('--scale'), la durée de frame visée par la résolution dynamique
+ * ('--frame-budget', en millisecondes), le rendu de la vue dans un
+ * tampon rangé par colonnes ('--column-major') et les textures indexées
+ * sur une palette ('--indexed').
+ *
+ * @param o Pointeur vers les options à remplir.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'argument à analyser dans 'av'.
+ * @return L'index du dernier argument consommé.
+ */
+int	parse_window_option(t_Options *o, int ac, char **av, int i)
+{
+	if (!ft_strncmp(av[i], "--size", 7))
+		size_value(o, ac, av, i++);
+	else if (!ft_strncmp(av[i], "--scale", 8))
+	{
+		o->scale = option_value(ac, av, i++);
+		if (o->scale < SCALE_MIN || o->scale > 100)
+			usage_exit("--scale expects a percentage from 25 to 100");
+	}
+	else if (!ft_strncmp(av[i], "--frame-budget", 15))
+	{
+		o->frame_budget = option_value(ac, av, i++);
+		if (!o->frame_budget)
+			usage_exit("--frame-budget expects at least 1 ms");
+	}
+	else if (!ft_strncmp(av[i], "--column-major", 15))
+		o->column_major = true;
+	else if (!ft_strncmp(av[i], "--indexed", 10))
+		o->indexed = true;
+	else
+		usage_exit("Unknown option or extra argument");
+	return (i);
+}
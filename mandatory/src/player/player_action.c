@@ -6,8 +6,9 @@
  * La fonction `use_action` calcule la position à laquelle le joueur a
  * l'intention d'effectuer une action d'utilisation en fonction de sa position
  * et de sa direction actuelles. Il vérifie si la tuile à la position calculée
- * sur la carte du jeu est un "9", représentant une porte. Si c'est le cas,
- * cela change la tuile en '0', indiquant que la porte a été utilisée. Sinon,
+ * sur la carte de la simulation ('world') est un "9", représentant une porte. Si c'est le cas,
+ * cela change la tuile en '0', indiquant que la porte a été utilisée, et
+ * compte le changement dans 'door_changes'. Sinon,
  * il renvoie une erreur pour signifier qu'aucune action n'a été effectuée.
  *
  * @ param p Pointeur vers la structure PlayerConfig contenant les informations sur le joueur.
@@ -18,42 +19,66 @@ int	use_action(t_PlayerConfig *p, t_MapConfig *m)
 {
 	p->use_distance_x = p->pos_x + 0.7 * p->dir_x;
 	p->use_distance_y = p->pos_y + 0.7 * p->dir_y;
-	if (m->matrix[(int)p->use_distance_y][(int)p->use_distance_x] == '9')
-		m->matrix[(int)p->use_distance_y][(int)p->use_distance_x] = '0';
+	if (m->world[(int)p->use_distance_y][(int)p->use_distance_x] == '9')
+		m->world[(int)p->use_distance_y][(int)p->use_distance_x] = '0';
 	else
 		return (1);
+	m->door_changes++;
 	return (0);
 }
 
 /**
- * @brief Animer le tir de l'arme du joueur.
+ * @brief Affiche l'image demandée de l'animation de tir du pistolet.
  *
- * La fonction `shoot_gun` gère l'animation de tir de l'arme du joueur.
- * Il faut un compteur en entrée pour déterminer l'image d'animation actuelle.
- * En fonction de la valeur du compteur, il met à jour l'image du pistolet pour
- * afficher l'image correspondante de l'animation de tir. Lorsque l'animation est terminée,
- * elle réinitialise le compteur et restaure l'image par défaut du pistolet.
+ * La fonction `shoot_gun` charge le sprite du pistolet correspondant à l'image
+ * 'frame' de l'animation de tir (0 pour le pistolet au repos). L'image est
+ * avancée par la simulation; le rendu appelle cette fonction sur le thread
+ * principal uniquement lorsque l'image affichée ('gun_shown') a changé.
  *
  * @param cub Pointeur vers la structure de configuration du jeu Cub3D.
  * @param p Pointeur vers la structure PlayerConfig contenant les informations sur le joueur.
- * @param counter Pointeur vers un compteur d'entiers pour les images d'animation.
+ * @param frame L'image de l'animation de tir à afficher.
  */
-void	shoot_gun(t_Cub3d *cub, t_PlayerConfig *p, int *counter)
+void	shoot_gun(t_Cub3d *cub, t_PlayerConfig *p, int frame)
 {
-	if (*counter)
-		mlx_destroy_image(cub->mlx_ptr, p->gun->img->img_ptr);
-	if (*counter == 1)
+	if (frame == p->gun_shown)
+		return ;
+	mlx_destroy_image(cub->mlx_ptr, p->gun->img->img_ptr);
+	if (frame == 1)
 		setup_menu(cub, p->gun, "./sprites/Gun_Sprites/g_01.xpm");
-	else if (*counter == 2)
+	else if (frame == 2)
 		setup_menu(cub, p->gun, "./sprites/Gun_Sprites/g_02.xpm");
-	else if (*counter == 3)
+	else if (frame == 3)
 		setup_menu(cub, p->gun, "./sprites/Gun_Sprites/g_03.xpm");
-	else if (*counter == 4)
+	else if (frame == 4)
 		setup_menu(cub, p->gun, "./sprites/Gun_Sprites/g_04.xpm");
-	else if (*counter == 5)
-	{
+	else
 		setup_menu(cub, p->gun, "./sprites/Gun_Sprites/g_00.xpm");
+	p->gun_shown = frame;
+}
+
+/**
+ * @brief Fait avancer l'animation de tir d'un tick.
+ *
+ * La fonction `gun_animation_tick` est appelée à chaque tick de la simulation.
+ * Tant que le joueur tire, elle passe à l'image suivante toutes les
+ * GUN_ANIM_TICKS ticks. Après la quatrième image, l'animation revient au
+ * repos et le flag 'shoot' est réinitialisé.
+ *
+ * @param p Pointeur vers la structure PlayerConfig contenant les informations sur le joueur.
+ */
+void	gun_animation_tick(t_PlayerConfig *p)
+{
+	if (!p->shoot)
+		return ;
+	p->gun_ticks++;
+	if (p->gun_ticks < GUN_ANIM_TICKS)
+		return ;
+	p->gun_ticks = 0;
+	p->gun_frame++;
+	if (p->gun_frame == 5)
+	{
+		p->gun_frame = 0;
 		p->shoot = 0;
-		*counter = 0;
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,156 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie le nom court d'une étape du profileur.
+ *
+ * @param stage L'étape (PROF_*).
+ * @return Le nom de l'étape, utilisé par l'overlay et l'en-tête CSV.
+ */
+char	*prof_stage_name(int stage)
+{
+	static char	*names[PROF_STAGES] = {"move", "doors", "image", "minimap",
+		"floor", "cast", "texture", "transp", "upscale", "hud", "present",
+		"frame"};
+
+	return (names[stage]);
+}
+
+/**
+ * @brief Assombrit une zone rectangulaire de l'image du jeu.
+ *
+ * Chaque canal de couleur est divisé par quatre pour que le texte de
+ * l'overlay reste lisible quel que soit le décor.
+ *
+ * @param img L'image à modifier.
+ * @param r Le rectangle {x, y, largeur, hauteur}.
+ */
+static void	darken_rect(t_ImageControl *img, int r[4])
+{
+	int				x;
+	int				y;
+	unsigned int	*px;
+
+	y = r[1];
+	while (y < r[1] + r[3] && y < img->height)
+	{
+		x = r[0];
+		while (x < r[0] + r[2] && x < img->width)
+		{
+			px = (unsigned int *)(img->addr + y * img->len + x * img->bpp / 8);
+			*px = (*px >> 2) & 0x3F3F3F;
+			x++;
+		}
+		y++;
+	}
+}
+
+/**
+ * @brief Dessine sous l'overlay le tableau des compteurs matériels.
+ *
+ * Avec l'option '--perf', chaque étape affiche son temps CPU en
+ * millisecondes par frame, ses instructions par cycle (IPC) et ses défauts de
+ * cache L1D et LLC et ses mauvaises prédictions de branchement (BR) pour
+ * mille instructions. Un compteur absent est affiché '-'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Le rectangle de l'overlay principal {x, y, largeur, hauteur}.
+ */
+static void	perf_draw_overlay(t_Cub3d *cub, int r[4])
+{
+	char	line[64];
+	int		i;
+
+	r[2] = 44 * (cub->font->w + FONT_SCALE) + 20;
+	r[0] = cub->win->width - r[2] - 20;
+	r[1] += r[3] + 10;
+	darken_rect(cub->img, r);
+	draw_text(cub, r[0] + 10, r[1] + 10,
+		"STAGE       CPU    IPC    L1D    LLC     BR");
+	i = 0;
+	while (i < PROF_STAGES)
+	{
+		perf_overlay_line(cub->prof->perf, i, line, sizeof(line));
+		draw_text(cub, r[0] + 10, r[1] + 10 + (i + 1) * (cub->font->h + 6),
+			line);
+		i++;
+	}
+}
+
+/**
+ * @brief Dessine sous l'overlay les compteurs du rendu de la dernière frame.
+ *
+ * Le tableau des compteurs matériels est d'abord dessiné s'il existe, puis
+ * le panneau des compteurs du rendu: pas du DDA par colonne (moyenne et
+ * maximum), pixels de mur, texels lus, pixels écrits, surcharge (écritures en
+ * trop et leur rapport à la taille de l'image), colonnes touchant une
+ * porte, puis taux de colonnes servies par une table de lignes de texture
+ * existante et mémoire des tables.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Le rectangle du panneau précédent {x, y, largeur, hauteur}.
+ */
+static void	stats_draw_overlay(t_Cub3d *cub, int r[4])
+{
+	t_RenderStats	*s;
+	char			l[7][40];
+	int				i;
+
+	if (cub->prof->perf)
+		perf_draw_overlay(cub, r);
+	s = &cub->prof->last;
+	r[1] += r[3] + 10;
+	r[3] = 7 * (cub->font->h + 6) + 20;
+	darken_rect(cub->img, r);
+	snprintf(l[0], 40, "DDA STEPS %7.2f MAX %5d", s->steps
+		/ (double)s->columns, s->max_steps);
+	snprintf(l[1], 40, "WALL PX   %19lld", s->wall_px);
+	snprintf(l[2], 40, "TEXELS    %19lld", s->texels);
+	snprintf(l[3], 40, "WRITES    %19lld", s->writes);
+	snprintf(l[4], 40, "OVERDRAW  %12lld %5.2fX", s->overdraw,
+		s->overdraw / (double)s->pixels);
+	snprintf(l[5], 40, "DOOR COLS %19d", s->doors);
+	snprintf(l[6], 40, "SCALER %6.2f%% HIT %8lld KB", 100.0 * s->scaler_hits
+		/ fmax(1, s->scaler_hits + s->scaler_misses), s->scaler_bytes / 1024);
+	i = -1;
+	while (++i < 7)
+		draw_text(cub, r[0] + 10, r[1] + 10 + i * (cub->font->h + 6), l[i]);
+}
+
+/**
+ * @brief Dessine l'overlay du profileur dans l'image du jeu.
+ *
+ * Lorsque l'overlay est activé (touche F3), la fonction 'prof_draw_overlay'
+ * affiche en haut à droite de l'écran le minimum, la moyenne et le 99e
+ * centile en millisecondes de chaque étape, sur les PROF_WINDOW dernières
+ * frames, puis les compteurs matériels si l'option '--perf' est donnée et
+ * les compteurs du rendu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	prof_draw_overlay(t_Cub3d *cub)
+{
+	t_ProfStage	*s;
+	char		line[64];
+	int			r[4];
+	int			i;
+
+	if (!cub->prof->overlay)
+		return ;
+	r[2] = 30 * (cub->font->w + FONT_SCALE) + 20;
+	r[3] = (PROF_STAGES + 1) * (cub->font->h + 6) + 20;
+	r[0] = cub->win->width - r[2] - 20;
+	r[1] = 20;
+	darken_rect(cub->img, r);
+	draw_text(cub, r[0] + 10, r[1] + 10, "STAGE       MIN    AVG    P99");
+	i = 0;
+	while (i < PROF_STAGES)
+	{
+		s = &cub->prof->stage[i];
+		snprintf(line, sizeof(line), "%-8s %6.2f %6.2f %6.2f",
+			prof_stage_name(i), s->min, s->avg, s->p99);
+		draw_text(cub, r[0] + 10, r[1] + 10 + (i + 1) * (cub->font->h + 6),
+			line);
+		i++;
+	}
+	stats_draw_overlay(cub, r);
+}
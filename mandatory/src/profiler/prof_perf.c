@@ -0,0 +1,145 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Ouvre un compteur et l'ajoute au groupe du profileur.
+ *
+ * Seul le thread principal est compté, sur n'importe quel processeur, et
+ * seulement en mode utilisateur: c'est ce que 'perf_event_paranoid' permet
+ * sans privilèges. Le premier compteur ouvert devient le meneur du groupe.
+ *
+ * @param e Le compteur à ouvrir (PERF_*).
+ * @param leader Descripteur du meneur du groupe, ou -1.
+ * @return Le descripteur du compteur, ou -1 en cas d'échec.
+ */
+static int	perf_open(int e, int leader)
+{
+	static unsigned int			type[PERF_EVENTS] = {PERF_TYPE_SOFTWARE,
+		PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+		PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE};
+	static unsigned long long	config[PERF_EVENTS] = {
+		PERF_COUNT_SW_TASK_CLOCK, PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_L1D
+		| PERF_COUNT_HW_CACHE_OP_READ << 8
+		| PERF_COUNT_HW_CACHE_RESULT_MISS << 16,
+		PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+	struct perf_event_attr		attr;
+
+	ft_bzero(&attr, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type[e];
+	attr.config = config[e];
+	attr.read_format = PERF_FORMAT_GROUP;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0));
+}
+
+/**
+ * @brief Ouvre les compteurs matériels de l'option '--perf'.
+ *
+ * Le temps CPU du thread mène le groupe: s'il ne peut pas être ouvert,
+ * 'perf_event_open' est indisponible et l'initialisation échoue. Les
+ * compteurs matériels absents (machine virtuelle, processeur sans PMU) sont
+ * signalés puis ignorés.
+ *
+ * @param p Pointeur vers le profileur.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+int	perf_init(t_Profiler *p)
+{
+	int	leader;
+	int	e;
+	int	n;
+
+	leader = perf_open(PERF_TASK, -1);
+	if (leader < 0)
+		return (printf("Error: perf_event_open: %s\n", strerror(errno)), 1);
+	p->perf = ft_calloc(1, sizeof(t_Perf));
+	if (!p->perf)
+		return (close(leader), 1);
+	p->perf->fd[PERF_TASK] = leader;
+	n = 1;
+	e = 1;
+	while (e < PERF_EVENTS)
+	{
+		p->perf->fd[e] = perf_open(e, leader);
+		p->perf->slot[e] = -1;
+		if (p->perf->fd[e] >= 0)
+			p->perf->slot[e] = n++;
+		else
+			printf("perf: %s unavailable: %s\n", perf_event_name(e),
+				strerror(errno));
+		e++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Lit les valeurs courantes de tous les compteurs du groupe.
+ *
+ * @param pf Pointeur vers les compteurs.
+ * @param out Reçoit la valeur de chaque compteur (PERF_*), 0 s'il est absent.
+ */
+void	perf_read(t_Perf *pf, long long *out)
+{
+	unsigned long long	buf[PERF_EVENTS + 1];
+	int					e;
+
+	if (read(pf->fd[PERF_TASK], buf, sizeof(buf)) < (ssize_t)sizeof(*buf))
+		buf[0] = 0;
+	e = 0;
+	while (e < PERF_EVENTS)
+	{
+		out[e] = 0;
+		if (pf->slot[e] >= 0 && pf->slot[e] < (int)buf[0])
+			out[e] = buf[1 + pf->slot[e]];
+		e++;
+	}
+}
+
+/**
+ * @brief Ajoute à l'en-tête CSV une colonne par étape et par compteur
+ * disponible.
+ *
+ * @param p Pointeur vers le profileur.
+ */
+void	perf_csv_header(t_Profiler *p)
+{
+	int	i;
+	int	e;
+
+	i = 0;
+	while (i < PROF_STAGES)
+	{
+		e = 0;
+		while (e < PERF_EVENTS)
+		{
+			if (p->perf->fd[e] >= 0)
+				fprintf(p->csv, ",%s_%s", prof_stage_name(i),
+					perf_event_name(e));
+			e++;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Ferme les compteurs et libère leur structure.
+ *
+ * @param pf Pointeur vers les compteurs, ou NULL.
+ */
+void	perf_free(t_Perf *pf)
+{
+	int	e;
+
+	if (!pf)
+		return ;
+	e = PERF_EVENTS - 1;
+	while (e >= 0)
+	{
+		if (pf->fd[e] >= 0)
+			close(pf->fd[e]);
+		e--;
+	}
+	free(pf);
+}
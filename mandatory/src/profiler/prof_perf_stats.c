@@ -0,0 +1,132 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie le nom d'un compteur matériel.
+ *
+ * @param event Le compteur (PERF_*).
+ * @return Le nom du compteur, utilisé par les messages et l'en-tête CSV.
+ */
+char	*perf_event_name(int event)
+{
+	static char	*names[PERF_EVENTS] = {"cpu_ns", "cycles", "instructions",
+		"l1d_misses", "llc_misses", "branch_misses"};
+
+	return (names[event]);
+}
+
+/**
+ * @brief Ferme la mesure d'une étape et ajoute ses compteurs à la frame.
+ *
+ * @param pf Pointeur vers les compteurs.
+ * @param stage L'étape mesurée (PROF_*).
+ */
+void	perf_end(t_Perf *pf, int stage)
+{
+	long long	now[PERF_EVENTS];
+	int			e;
+
+	perf_read(pf, now);
+	e = 0;
+	while (e < PERF_EVENTS)
+	{
+		pf->cur[stage][e] += now[e] - pf->start[stage][e];
+		e++;
+	}
+}
+
+/**
+ * @brief Clôt la frame courante pour les compteurs matériels.
+ *
+ * Les compteurs de chaque étape sont écrits bruts dans le fichier CSV, puis
+ * cumulés. Toutes les PROF_REFRESH frames, les cumuls deviennent ceux que
+ * l'overlay affiche et repartent de zéro.
+ *
+ * @param p Pointeur vers le profileur.
+ */
+void	perf_frame_end(t_Profiler *p)
+{
+	t_Perf	*pf;
+	int		i;
+	int		e;
+
+	pf = p->perf;
+	i = 0;
+	while (i < PROF_STAGES)
+	{
+		e = 0;
+		while (e < PERF_EVENTS)
+		{
+			if (p->csv && pf->fd[e] >= 0)
+				fprintf(p->csv, ",%lld", pf->cur[i][e]);
+			pf->sum[i][e] += pf->cur[i][e];
+			pf->cur[i][e++] = 0;
+		}
+		i++;
+	}
+	if (++pf->frames < PROF_REFRESH)
+		return ;
+	ft_memcpy(pf->last, pf->sum, sizeof(pf->last));
+	ft_bzero(pf->sum, sizeof(pf->sum));
+	pf->frames = 0;
+}
+
+/**
+ * @brief Écrit dans une cellule de l'overlay le rapport de deux compteurs.
+ *
+ * @param pf Pointeur vers les compteurs.
+ * @param stage L'étape (PROF_*).
+ * @param r Le rapport {numérateur, dénominateur, facteur}; le temps CPU est
+ * donné en millisecondes par frame.
+ * @param cell Reçoit la cellule, large de 6 caractères, ou '-' si l'un des
+ * compteurs est absent.
+ */
+static void	perf_ratio(t_Perf *pf, int stage, const int *r, char *cell)
+{
+	long long	num;
+	long long	den;
+
+	num = pf->last[stage][r[0]];
+	den = pf->last[stage][r[1]];
+	if (pf->fd[r[0]] < 0 || pf->fd[r[1]] < 0)
+		snprintf(cell, 8, "%6s", "-");
+	else if (r[0] == PERF_TASK)
+		snprintf(cell, 8, "%6.2f", num / 1e6 / PROF_REFRESH);
+	else if (!den)
+		snprintf(cell, 8, "%6.2f", 0.0);
+	else
+		snprintf(cell, 8, "%6.2f", num * (double)r[2] / den);
+}
+
+/**
+ * @brief Écrit la ligne de l'overlay des compteurs matériels d'une étape.
+ *
+ * La ligne donne, sur les PROF_REFRESH dernières frames, le temps CPU de
+ * l'étape en millisecondes par frame, ses instructions par cycle, puis ses
+ * défauts de cache L1D et LLC et ses mauvaises prédictions de branchement
+ * pour mille instructions.
+ *
+ * @param pf Pointeur vers les compteurs.
+ * @param stage L'étape (PROF_*).
+ * @param line Reçoit la ligne.
+ * @param size Taille du tampon 'line'.
+ * @return La longueur de la ligne écrite.
+ */
+int	perf_overlay_line(t_Perf *pf, int stage, char *line, int size)
+{
+	static const int	ratios[5][3] = {{PERF_TASK, PERF_TASK, 1},
+	{PERF_INSTR, PERF_CYCLES, 1}, {PERF_L1D, PERF_INSTR, 1000},
+	{PERF_LLC, PERF_INSTR, 1000}, {PERF_BRANCH, PERF_INSTR, 1000}};
+	char				cell[8];
+	int					len;
+	int					i;
+
+	len = snprintf(line, size, "%-8s", prof_stage_name(stage));
+	i = 0;
+	while (i < 5 && len < size)
+	{
+		perf_ratio(pf, stage, ratios[i], cell);
+		len += snprintf(line + len, size - len, " %s", cell);
+		i++;
+	}
+	return (len);
+}
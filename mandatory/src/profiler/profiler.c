@@ -0,0 +1,159 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Initialise le profileur de frames.
+ *
+ * La fonction 'prof_init' alloue la structure 't_Profiler', mémorise le
+ * thread principal (seul autorisé à mesurer) et construit le cache de la
+ * police de l'overlay. L'option '--perf' ouvre les compteurs matériels. Si
+ * l'option '--profile-out' est donnée, le fichier CSV est ouvert et reçoit
+ * sa ligne d'en-tête.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation ou d'ouverture.
+ */
+int	prof_init(t_Cub3d *cub)
+{
+	int	i;
+
+	cub->prof = ft_calloc(1, sizeof(t_Profiler));
+	if (!cub->prof || font_init(cub))
+		return (1);
+	cub->prof->owner = pthread_self();
+	cub->prof->trace = cub->trace;
+	cub->prof->heatmap = cub->opt->heatmap;
+	if (cub->trace)
+		cub->trace->frame = 0;
+	if (cub->opt->perf && perf_init(cub->prof))
+		return (1);
+	if (!cub->opt->profile_out)
+		return (0);
+	cub->prof->csv = fopen(cub->opt->profile_out, "w");
+	if (!cub->prof->csv)
+		return (printf("Error: cannot open %s\n", cub->opt->profile_out), 1);
+	fprintf(cub->prof->csv, "frame");
+	i = 0;
+	while (i < PROF_STAGES)
+		fprintf(cub->prof->csv, ",%s_us", prof_stage_name(i++));
+	stats_csv_header(cub->prof);
+	fprintf(cub->prof->csv, "\n");
+	return (0);
+}
+
+/**
+ * @brief Ouvre la mesure d'une étape de la frame.
+ *
+ * Les mesures faites hors du thread principal (simulation multi-thread) sont
+ * ignorées, pour que le profileur n'ait besoin d'aucune synchronisation. Les
+ * compteurs matériels sont lus avant l'horloge, pour que leur appel système
+ * ne compte pas dans la durée de l'étape. Avec '--trace', le début de
+ * l'étape est placé dans la chronologie, quel que soit le thread.
+ *
+ * @param p Pointeur vers le profileur.
+ * @param stage L'étape mesurée (PROF_*).
+ */
+void	prof_begin(t_Profiler *p, int stage)
+{
+	trace_event(p->trace, prof_stage_name(stage), 'B', NULL);
+	if (!pthread_equal(pthread_self(), p->owner))
+		return ;
+	if (p->perf)
+		perf_read(p->perf, p->perf->start[stage]);
+	p->stage[stage].start = get_time_ns();
+}
+
+/**
+ * @brief Ferme la mesure d'une étape et l'ajoute au total de la frame.
+ *
+ * Une étape peut être mesurée plusieurs fois par frame (par exemple à chaque
+ * tick de la simulation): les durées s'additionnent.
+ *
+ * @param p Pointeur vers le profileur.
+ * @param stage L'étape mesurée (PROF_*).
+ */
+void	prof_end(t_Profiler *p, int stage)
+{
+	if (pthread_equal(pthread_self(), p->owner))
+	{
+		p->stage[stage].cur += get_time_ns() - p->stage[stage].start;
+		if (p->perf)
+			perf_end(p->perf, stage);
+	}
+	trace_event(p->trace, prof_stage_name(stage), 'E', NULL);
+}
+
+/**
+ * @brief Calcule le minimum, la moyenne et le 99e centile d'une étape.
+ *
+ * Les échantillons de la fenêtre glissante sont copiés puis triés par
+ * insertion (PROF_WINDOW est petit). Les résultats sont en millisecondes.
+ *
+ * @param p Pointeur vers le profileur.
+ * @param s L'étape dont les statistiques sont calculées.
+ */
+static void	prof_stats(t_Profiler *p, t_ProfStage *s)
+{
+	long long	tmp[PROF_WINDOW];
+	long long	sum;
+	long long	v;
+	int			i;
+	int			j;
+
+	sum = 0;
+	i = 0;
+	while (i < p->count)
+	{
+		v = s->ring[i];
+		sum += v;
+		j = i;
+		while (j > 0 && tmp[j - 1] > v)
+		{
+			tmp[j] = tmp[j - 1];
+			j--;
+		}
+		tmp[j] = v;
+		i++;
+	}
+	s->min = tmp[0] / 1e6;
+	s->avg = sum / (double)p->count / 1e6;
+	s->p99 = tmp[(p->count * 99) / 100] / 1e6;
+}
+
+/**
+ * @brief Clôt la frame courante dans le profileur.
+ *
+ * La fonction 'prof_frame_end' range la durée de chaque étape dans la fenêtre
+ * glissante de PROF_WINDOW frames, écrit la ligne CSV de la frame si besoin,
+ * compteurs du rendu et compteurs matériels compris, et remet les compteurs
+ * à zéro. Les statistiques affichées par l'overlay
+ * sont recalculées toutes les PROF_REFRESH frames seulement.
+ *
+ * @param p Pointeur vers le profileur.
+ */
+void	prof_frame_end(t_Profiler *p)
+{
+	int	i;
+
+	if (p->csv)
+		fprintf(p->csv, "%lld", p->frames);
+	i = 0;
+	while (i < PROF_STAGES)
+	{
+		p->stage[i].ring[p->head] = p->stage[i].cur;
+		if (p->csv)
+			fprintf(p->csv, ",%.1f", p->stage[i].cur / 1e3);
+		p->stage[i++].cur = 0;
+	}
+	stats_frame_end(p);
+	if (p->csv)
+		fprintf(p->csv, "\n");
+	p->head = (p->head + 1) % PROF_WINDOW;
+	if (p->count < PROF_WINDOW)
+		p->count++;
+	p->frames++;
+	if (p->trace)
+		atomic_store(&p->trace->frame, p->frames);
+	i = 0;
+	while (p->overlay && p->frames % PROF_REFRESH == 0 && i < PROF_STAGES)
+		prof_stats(p, &p->stage[i++]);
+}
@@ -0,0 +1,176 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Convertit un nombre en virgule fixe, arrondi au plus proche.
+ *
+ * L'arrondi garde exactes les valeurs simples (positions entières, rayons
+ * à 45 degrés) que la troncature décalerait d'une unité. Les distances
+ * delta des rayons parallèles à un axe valent 1e30: elles sont bornées à
+ * FIX_DIST_MAX, qui dépasse toujours la largeur de la carte et laisse la
+ * somme du DDA loin du débordement.
+ *
+ * @param d Le nombre en virgule flottante.
+ * @return Le nombre en virgule fixe, à FIX_SHIFT bits de fraction.
+ */
+long long	fix_from(double d)
+{
+	if (d >= (double)FIX_DIST_MAX / FIX_ONE)
+		return (FIX_DIST_MAX);
+	if (d < 0)
+		return (-(long long)(-d * FIX_ONE + 0.5));
+	return ((long long)(d * FIX_ONE + 0.5));
+}
+
+/**
+ * @brief Calcule le pas et la distance latérale initiale d'un rayon en
+ * virgule fixe.
+ *
+ * Équivalent de 'step_calculation' pour le moteur FIXED_POINT: la cellule
+ * de départ est la partie entière de la position ('map_x' et 'map_y',
+ * remplis par 'init_rays') et la distance jusqu'à la première limite de
+ * cellule est la partie fractionnaire, ou son complément, multipliée par
+ * la distance delta.
+ *
+ * @param c Pointeur vers la configuration de la caméra.
+ */
+void	step_fixed(t_CameraConfig *c)
+{
+	long long	frac;
+
+	c->hit = 0;
+	c->steps = 0;
+	c->step_x = 1;
+	if (c->fx.raydir_x < 0)
+		c->step_x = -1;
+	frac = c->fpos_x & (FIX_ONE - 1);
+	if (c->step_x > 0)
+		frac = FIX_ONE - frac;
+	c->fx.s_dist_x = (frac * c->fx.ddist_x) >> FIX_SHIFT;
+	c->step_y = 1;
+	if (c->fx.raydir_y < 0)
+		c->step_y = -1;
+	frac = c->fpos_y & (FIX_ONE - 1);
+	if (c->step_y > 0)
+		frac = FIX_ONE - frac;
+	c->fx.s_dist_y = (frac * c->fx.ddist_y) >> FIX_SHIFT;
+}
+
+/**
+ * @brief Applique le DDA en virgule fixe jusqu'au premier mur touché.
+ *
+ * Équivalent de 'apply_dda' pour le moteur FIXED_POINT: les distances
+ * latérales sont des entiers, comparés et incrémentés sans virgule
+ * flottante.
+ *
+ * @param c Pointeur vers la configuration de la caméra.
+ * @param m Pointeur vers la structure 't_MapConfig' contenant les données de
+ * la carte du jeu.
+ */
+void	dda_fixed(t_CameraConfig *c, t_MapConfig *m)
+{
+	while (!c->hit)
+	{
+		if (c->fx.s_dist_x < c->fx.s_dist_y)
+		{
+			c->fx.s_dist_x += c->fx.ddist_x;
+			c->map_x += c->step_x;
+			c->side = 0;
+		}
+		else
+		{
+			c->fx.s_dist_y += c->fx.ddist_y;
+			c->map_y += c->step_y;
+			c->side = 1;
+		}
+		c->steps++;
+		if (m->matrix[c->map_y][c->map_x] >= '1'
+			&& m->matrix[c->map_y][c->map_x] <= '9')
+			c->hit = 1;
+	}
+}
+
+/**
+ * @brief Calcule la hauteur du mur et le point d'impact en virgule fixe.
+ *
+ * Équivalent de 'calculate_wall_height' pour le moteur FIXED_POINT. La
+ * hauteur du mur est une division entière. Le point d'impact sur le mur
+ * ('wall_fx') est la coordonnée touchée moins celle de la cellule, comme
+ * dans 'get_wall_x', avec un produit arrondi au plus proche. La distance
+ * est aussi rangée en virgule flottante dans 'perp_wd', pour la table des
+ * impacts.
+ *
+ * @param c Pointeur vers la configuration de la caméra.
+ */
+void	wall_height_fixed(t_CameraConfig *c)
+{
+	long long	hit;
+
+	if (c->side == 0)
+		c->fx.perp_wd = c->fx.s_dist_x - c->fx.ddist_x;
+	else
+		c->fx.perp_wd = c->fx.s_dist_y - c->fx.ddist_y;
+	c->perp_wd = (double)c->fx.perp_wd / FIX_ONE;
+	c->line_height = c->width * WINDOW_Y / WINDOW_X;
+	if (c->fx.perp_wd > 0)
+		c->line_height = ((long long)c->line_height << FIX_SHIFT)
+			/ c->fx.perp_wd;
+	c->draw_start = -c->line_height / 2 + c->height / 2;
+	if (c->draw_start < 0)
+		c->draw_start = 0;
+	c->draw_end = c->line_height / 2 + c->height / 2;
+	if (c->draw_end >= c->height)
+		c->draw_end = c->height - 1;
+	if (c->side == 0)
+		hit = c->fpos_y - ((long long)c->map_y << FIX_SHIFT)
+			+ ((c->fx.perp_wd * c->fx.raydir_y + FIX_ONE / 2) >> FIX_SHIFT);
+	else
+		hit = c->fpos_x - ((long long)c->map_x << FIX_SHIFT)
+			+ ((c->fx.perp_wd * c->fx.raydir_x + FIX_ONE / 2) >> FIX_SHIFT);
+	c->wall_fx = hit;
+}
+
+/**
+ * @brief Texture une colonne de mur en virgule fixe.
+ *
+ * Équivalent de 'apply_texture' pour le moteur FIXED_POINT: la colonne de
+ * la texture vient de 'wall_fx', et la position dans la texture avance
+ * d'un pas à TEX_SHIFT bits de fraction par pixel; la ligne lue est un
+ * simple décalage, sans conversion de flottant en entier. Le pas est
+ * arrondi par excès: la ligne lue est alors exactement celle du calcul en
+ * nombres réels, et elle reboucle comme celle des tables de lignes
+ * ('texture_wrap'). Comme dans 'apply_texture', une colonne dont l'impact
+ * tombe hors de la texture (pile sur le coin d'une cellule) n'est pas
+ * dessinée, pas plus qu'une texture de moins de deux lignes, qui n'a pas de
+ * moitié haute où reboucler; le test est fait une fois par colonne.
+ *
+ * @param cub Pointeur vers la structure 't_Cub3d'.
+ * @param c Pointeur vers la configuration de la caméra.
+ * @param x La colonne d'écran en cours de traitement.
+ * @param id L'entrée de l'atlas de la texture à appliquer ('wall_tex').
+ */
+void	texture_fixed(t_Cub3d *cub, t_CameraConfig *c, int x, int id)
+{
+	t_ImageControl	*img;
+	long long		step;
+	long long		pos;
+	int				tx;
+	int				y;
+
+	img = &cub->atlas->tex[id];
+	tx = img->width - (((long long)c->wall_fx * img->width) >> FIX_SHIFT) - 1;
+	if (c->line_height <= 0 || tx < 0 || tx >= img->width || img->height < 2)
+		return ;
+	step = (((long long)img->width << TEX_SHIFT) + c->line_height - 1)
+		/ c->line_height;
+	pos = (c->draw_start - c->height / 2 + c->line_height) * step;
+	y = c->draw_start;
+	while (y++ < c->draw_end)
+	{
+		c->color = my_mlx_pixel_get(img, tx,
+				texture_wrap(pos >> TEX_SHIFT, img->height / 2));
+		c->color = apply_shader(c->color, c->wall_dir);
+		view_pixel_put(cub, x, y, c->color);
+		cub->atlas->reads++;
+		pos += step;
+	}
+}
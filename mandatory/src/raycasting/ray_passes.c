@@ -0,0 +1,116 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Sauvegarde le résultat du lancer de rayon de la colonne courante.
+ *
+ * @param c Pointeur vers la configuration de la caméra après le DDA.
+ * @param h L'entrée de la table des impacts à remplir.
+ */
+static void	store_hit(t_CameraConfig *c, t_RayHit *h)
+{
+	h->raydir_x = c->raydir_x;
+	h->raydir_y = c->raydir_y;
+	h->perp_wd = c->perp_wd;
+	h->map_x = c->map_x;
+	h->map_y = c->map_y;
+	h->side = c->side;
+	h->line_height = c->line_height;
+	h->draw_start = c->draw_start;
+	h->draw_end = c->draw_end;
+	h->wall_dir = c->wall_dir;
+	h->steps = c->steps;
+	h->wall_fx = c->wall_fx;
+	h->wall_tex = c->wall_tex;
+}
+
+/**
+ * @brief Recharge dans la caméra le résultat du lancer de rayon d'une colonne.
+ *
+ * @param c Pointeur vers la configuration de la caméra.
+ * @param h L'entrée de la table des impacts à relire.
+ */
+static void	load_hit(t_CameraConfig *c, t_RayHit *h)
+{
+	c->raydir_x = h->raydir_x;
+	c->raydir_y = h->raydir_y;
+	c->perp_wd = h->perp_wd;
+	c->map_x = h->map_x;
+	c->map_y = h->map_y;
+	c->side = h->side;
+	c->line_height = h->line_height;
+	c->draw_start = h->draw_start;
+	c->draw_end = h->draw_end;
+	c->wall_dir = h->wall_dir;
+	c->wall_fx = h->wall_fx;
+	c->wall_tex = h->wall_tex;
+}
+
+/**
+ * @brief Lance les rayons de toutes les colonnes de l'écran.
+ *
+ * La fonction 'cast_rays' exécute la première passe du rendu: elle met à
+ * jour la table des directions des rayons si la caméra a tourné, puis, pour
+ * chaque colonne, elle initialise le rayon, applique le DDA, calcule la hauteur et
+ * la direction du mur touché, puis range le résultat dans 'cam->hits'.
+ * Aucun pixel n'est écrit pendant cette passe. Le moteur FIXED_POINT,
+ * choisi à la compilation, remplace le DDA et le calcul de la hauteur par
+ * leurs équivalents en virgule fixe.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	cast_rays(t_Cub3d *cub)
+{
+	t_CameraConfig	*cam;
+	int				x;
+
+	cam = cub->cam;
+	ray_table_update(cub);
+	x = 0;
+	while (x < cub->win->render_w)
+	{
+		init_rays(cub, cam, x);
+		if (FIXED_POINT)
+		{
+			step_fixed(cam);
+			dda_fixed(cam, cub->map);
+			wall_height_fixed(cam);
+		}
+		else
+		{
+			step_calculation(cam, &cub->sim->view);
+			apply_dda(cam, cub->map);
+			calculate_wall_height(cam);
+		}
+		get_wall_direction(cub->map, cam);
+		store_hit(cam, &cam->hits[x]);
+		x++;
+	}
+}
+
+/**
+ * @brief Texture les murs à partir de la table des impacts.
+ *
+ * La fonction 'texture_rays' exécute la seconde passe du rendu: pour chaque
+ * colonne, elle relit l'impact calculé par 'cast_rays' et dessine la colonne
+ * de mur texturée correspondante, en virgule fixe avec le moteur
+ * FIXED_POINT.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	texture_rays(t_Cub3d *cub)
+{
+	t_CameraConfig	*cam;
+	int				x;
+
+	cam = cub->cam;
+	x = 0;
+	while (x < cub->win->render_w)
+	{
+		load_hit(cam, &cam->hits[x]);
+		if (FIXED_POINT)
+			texture_fixed(cub, cam, x, cam->wall_tex);
+		else
+			apply_texture(cub, cam, x, cam->wall_tex);
+		x++;
+	}
+}
@@ -0,0 +1,75 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Calcule la direction du rayon d'une colonne de l'écran.
+ *
+ * La position de la colonne sur le plan de la caméra ('camera_x', de -1 à
+ * 1) donne la direction du rayon, puis la distance delta ('ddist_x' et
+ * 'ddist_y') nécessaire pour passer d'une cellule de la grille à la suivante
+ * dans chaque direction. Les deux sont aussi rangées en virgule fixe pour
+ * le moteur FIXED_POINT.
+ *
+ * @param r L'entrée de la table à remplir.
+ * @param v La vue de la simulation.
+ * @param x La colonne de l'écran.
+ * @param width La largeur de la vue 3D.
+ */
+static void	ray_dir_init(t_RayDir *r, t_SimState *v, int x, int width)
+{
+	double	camera_x;
+
+	camera_x = 2 * x / (double)width - 1;
+	r->raydir_x = v->dir_x + v->plane_x * camera_x;
+	r->raydir_y = v->dir_y + v->plane_y * camera_x;
+	if (!r->raydir_x)
+		r->ddist_x = 1e30;
+	else
+		r->ddist_x = fabs(1 / r->raydir_x);
+	if (!r->raydir_y)
+		r->ddist_y = 1e30;
+	else
+		r->ddist_y = fabs(1 / r->raydir_y);
+	r->fx.raydir_x = fix_from(r->raydir_x);
+	r->fx.raydir_y = fix_from(r->raydir_y);
+	r->fx.ddist_x = fix_from(r->ddist_x);
+	r->fx.ddist_y = fix_from(r->ddist_y);
+}
+
+/**
+ * @brief Met à jour la table des directions des rayons.
+ *
+ * La direction du rayon de chaque colonne ne dépend que de la direction et
+ * du plan de la caméra, pas de sa position: la table n'est recalculée que
+ * si la caméra a tourné ou si la résolution de la vue 3D a changé. Une
+ * frame où le joueur ne fait que se déplacer réutilise la table telle
+ * quelle. La position de la caméra en virgule fixe, elle, est mise à jour
+ * à chaque frame.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	ray_table_update(t_Cub3d *cub)
+{
+	t_CameraConfig	*c;
+	t_SimState		*v;
+	int				x;
+
+	c = cub->cam;
+	v = &cub->sim->view;
+	c->fpos_x = fix_from(v->pos_x);
+	c->fpos_y = fix_from(v->pos_y);
+	if (c->rays_w == cub->win->render_w && c->rays_dir.x == v->dir_x
+		&& c->rays_dir.y == v->dir_y && c->rays_plane.x == v->plane_x
+		&& c->rays_plane.y == v->plane_y)
+		return ;
+	c->rays_w = cub->win->render_w;
+	c->rays_dir.x = v->dir_x;
+	c->rays_dir.y = v->dir_y;
+	c->rays_plane.x = v->plane_x;
+	c->rays_plane.y = v->plane_y;
+	x = 0;
+	while (x < c->rays_w)
+	{
+		ray_dir_init(&c->rays[x], v, x, c->rays_w);
+		x++;
+	}
+}
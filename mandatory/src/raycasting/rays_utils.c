@@ -1,5 +1,29 @@
 #include "../../headers/cub3d.h"
 
+/**
+ * @brief Renvoie la texture de l'atlas du mur touché par le rayon.
+ *
+ * Un mur '1' prend la texture de la face touchée, une porte celle des
+ * portes et un matériau ('2' à '8') la sienne, quelle que soit la face.
+ *
+ * @param m Pointeur vers la configuration de la carte.
+ * @param c Pointeur vers la configuration de la caméra, 'wall_dir' rempli.
+ * @return L'index de la texture dans l'atlas.
+ */
+static int	wall_texture(t_MapConfig *m, t_CameraConfig *c)
+{
+	char	cell;
+
+	if (c->wall_dir == 9)
+		return (ATLAS_DOOR);
+	if (!c->hit)
+		return (c->wall_dir - 1);
+	cell = m->matrix[c->map_y][c->map_x];
+	if (cell >= MAT_FIRST && cell < MAT_FIRST + MAT_COUNT)
+		return (ATLAS_MAT + cell - MAT_FIRST);
+	return (c->wall_dir - 1);
+}
+
 /**
  * @brief Déterminez la direction du mur frappé par le rayon.
  *
@@ -7,6 +31,7 @@
  * par le rayon. Il assigne un code spécifique à `wall_dir` selon que
  * le rayon frappe un mur dans la direction nord, sud, est ou ouest.
  * Ces informations sont utiles pour le map de texture et le rendu correct des murs.
+ * La texture du mur dans l'atlas ('wall_tex') en est déduite.
  *
  * @param m Pointeur vers la structure 't_MapConfig' contenant les données de la carte du jeu
  * @param c Pointeur vers la structure 't_CameraConfig' contenant les données de
@@ -30,6 +55,7 @@ void	get_wall_direction(t_MapConfig *m, t_CameraConfig *c)
 		else
 			c->wall_dir = 4;
 	}
+	c->wall_tex = wall_texture(m, c);
 }
 
 /**
@@ -41,7 +67,10 @@ void	get_wall_direction(t_MapConfig *m, t_CameraConfig *c)
  * de la vue de la caméra et de la distance au mur. Il calcule ensuite la `line_height`
  * qui représente la hauteur du mur sur l'écran. Les valeurs `draw_start` et `draw_end`
  * sont définies pour spécifier où le segment de mur doit être dessiné dans l'espace
- * vertical de l'écran.
+ * vertical de l'écran. La hauteur d'un mur suit la largeur de la vue, dans
+ * les proportions de WINDOW_X * WINDOW_Y: le champ de vision horizontal est
+ * fixe et les murs gardent leur forme quelle que soit la taille de la
+ * fenêtre.
  *
  * @param cam Pointeur vers la structure 't_CameraConfig' contenantcontenant
  * les données de configuration de la caméra.
@@ -53,15 +82,16 @@ void	calculate_wall_height(t_CameraConfig *cam)
 	else
 		cam->perp_wd = (cam->s_dist_y - cam->ddist_y);
 	if (cam->perp_wd)
-		cam->line_height = (int)(WINDOW_Y / cam->perp_wd);
+		cam->line_height = (int)(cam->width * WINDOW_Y / WINDOW_X
+				/ cam->perp_wd);
 	else
-		cam->line_height = WINDOW_Y;
-	cam->draw_start = -cam->line_height / 2 + WINDOW_Y / 2;
+		cam->line_height = cam->width * WINDOW_Y / WINDOW_X;
+	cam->draw_start = -cam->line_height / 2 + cam->height / 2;
 	if (cam->draw_start < 0)
 		cam->draw_start = 0;
-	cam->draw_end = cam->line_height / 2 + WINDOW_Y / 2;
-	if (cam->draw_end >= WINDOW_Y)
-		cam->draw_end = WINDOW_Y - 1;
+	cam->draw_end = cam->line_height / 2 + cam->height / 2;
+	if (cam->draw_end >= cam->height)
+		cam->draw_end = cam->height - 1;
 }
 
 /**
@@ -75,7 +105,8 @@ void	calculate_wall_height(t_CameraConfig *cam)
  * `s_dist_x` et `s_dist_y` et met à jour la position actuelle de la carte 
  * (`map_x` et `map_y') ainsi que la direction du pas du rayon `step_x` 
  * et `step_y`. La variable `side` est définie sur 0 pour les résultats horizontaux
- * et 1 pour les résultats verticaux.
+ * et 1 pour les résultats verticaux. Les pas sont comptés dans `steps`. Les
+ * cellules '1' à '8' (murs et matériaux) et '9' (portes) arrêtent le rayon.
  *
  * @param cam Pointeur vers la structure 't_CameraConfig' contenant les données
  * de configuration de la caméra.
@@ -98,8 +129,9 @@ void	apply_dda(t_CameraConfig *cam, t_MapConfig *m)
 			cam->map_y += cam->step_y;
 			cam->side = 1;
 		}
-		if (m->matrix[cam->map_y][cam->map_x] == '1'
-			|| m->matrix[cam->map_y][cam->map_x] == '9')
+		cam->steps++;
+		if (m->matrix[cam->map_y][cam->map_x] >= '1'
+			&& m->matrix[cam->map_y][cam->map_x] <= '9')
 			cam->hit = 1;
 	}
 }
@@ -115,11 +147,12 @@ void	apply_dda(t_CameraConfig *cam, t_MapConfig *m)
  * latérale en conséquence.
  *
  * @param cam Un pointeur sur la structure de configuration de la caméra.
- * @param p Un pointeur vers la structure PlayerConfig représentant la position du joueur.
+ * @param p Un pointeur vers la vue interpolée représentant la position du joueur.
  */
-void	step_calculation(t_CameraConfig *cam, t_PlayerConfig *p)
+void	step_calculation(t_CameraConfig *cam, t_SimState *p)
 {
 	cam->hit = 0;
+	cam->steps = 0;
 	if (cam->raydir_x < 0)
 	{
 		cam->step_x = -1;
@@ -0,0 +1,139 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Ouvre le fichier d'enregistrement et écrit son en-tête.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Pointeur vers l'enregistrement.
+ * @return 0 en cas de succès, 1 si le fichier ne peut pas être écrit.
+ */
+static int	open_record(t_Cub3d *cub, t_Replay *r)
+{
+	t_ReplayHeader	h;
+
+	r->mode = REPLAY_RECORD;
+	r->file = fopen(cub->opt->record, "wb");
+	if (!r->file)
+		return (1);
+	h.magic = REPLAY_MAGIC;
+	h.version = REPLAY_VERSION;
+	h.tick_rate = cub->opt->tick_rate;
+	if (h.tick_rate <= 0)
+		h.tick_rate = SIM_HZ;
+	if (fwrite(&h, sizeof(h), 1, r->file) != 1)
+		return (1);
+	return (0);
+}
+
+/**
+ * @brief Ouvre un enregistrement à rejouer et vérifie son en-tête.
+ *
+ * La simulation reprend la fréquence de l'enregistrement et tourne sur le
+ * thread principal, pour que chaque tick lise exactement ses entrées. Chaque
+ * frame simule 'step' ticks, le rapport entre la fréquence de la simulation
+ * et le nombre de FPS visé.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Pointeur vers la relecture.
+ * @return 0 en cas de succès, 1 si le fichier est illisible ou invalide.
+ */
+static int	open_play(t_Cub3d *cub, t_Replay *r)
+{
+	t_ReplayHeader	h;
+	int				fps;
+
+	r->mode = REPLAY_PLAY;
+	r->file = fopen(cub->opt->replay, "rb");
+	if (!r->file || fread(&h, sizeof(h), 1, r->file) != 1)
+		return (1);
+	if (h.magic != REPLAY_MAGIC || h.version != REPLAY_VERSION
+		|| h.tick_rate <= 0)
+		return (1);
+	cub->opt->tick_rate = h.tick_rate;
+	cub->opt->sim_thread = false;
+	fps = cub->opt->target_fps;
+	if (fps <= 0)
+		fps = TARGET_FPS;
+	r->step = h.tick_rate / fps;
+	if (r->step < 1)
+		r->step = 1;
+	if (cub->opt->replay_fast)
+		cub->opt->target_fps = 0;
+	r->hash = FNV_OFFSET;
+	replay_next(r);
+	return (0);
+}
+
+/**
+ * @brief Prépare l'enregistrement ou la relecture des entrées.
+ *
+ * La fonction 'replay_init' ne fait rien si ni '--record' ni '--replay'
+ * n'est donné. Elle doit être appelée avant 'frame_clock_init' et
+ * 'sim_init', car la relecture impose la fréquence de la simulation et,
+ * avec '--replay-fast', supprime l'attente entre les frames.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+int	replay_init(t_Cub3d *cub)
+{
+	if (!cub->opt->record && !cub->opt->replay)
+		return (0);
+	cub->replay = ft_calloc(1, sizeof(t_Replay));
+	if (!cub->replay)
+		return (1);
+	if (cub->opt->record)
+		return (open_record(cub, cub->replay));
+	return (open_play(cub, cub->replay));
+}
+
+/**
+ * @brief Démarre la relecture sans passer par le menu.
+ *
+ * La partie commence immédiatement au tick 0, depuis la position de départ,
+ * comme lors de l'enregistrement après un clic sur "Start". Sans serveur X,
+ * le backend nul ne cadence plus la boucle: c'est l'horloge des frames qui
+ * s'en charge.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	replay_start(t_Cub3d *cub)
+{
+	if (!cub->replay || cub->replay->mode != REPLAY_PLAY)
+		return ;
+	if (cub->opt->headless)
+		mlx_null_set_rate(cub->mlx_ptr, 0);
+	sim_start(cub, false);
+	cub->menu_active = false;
+	cub->replay->start_ns = get_time_ns();
+}
+
+/**
+ * @brief Termine l'enregistrement ou la relecture et libère sa structure.
+ *
+ * La simulation est arrêtée d'abord, puis un enregistrement reçoit son
+ * événement de fin (INPUT_END), qui porte le nombre de ticks joués.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	replay_close(t_Cub3d *cub)
+{
+	t_ReplayEvent	e;
+
+	if (!cub->replay)
+		return ;
+	sim_stop(cub);
+	if (cub->replay->file && cub->replay->mode == REPLAY_RECORD)
+	{
+		e.tick = 0;
+		if (cub->sim)
+			e.tick = cub->sim->ticks;
+		e.keys = INPUT_END;
+		e.dx = 0;
+		fwrite(&e, sizeof(e), 1, cub->replay->file);
+	}
+	if (cub->replay->file)
+		fclose(cub->replay->file);
+	free(cub->replay);
+	cub->replay = NULL;
+}
@@ -0,0 +1,92 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Calcule l'empreinte FNV-1a des pixels visibles d'une image.
+ *
+ * Seuls les 'w' premiers pixels de chaque ligne sont lus, le remplissage de
+ * fin de ligne de MiniLibX n'entre pas dans l'empreinte. L'empreinte d'une
+ * image précédente peut être passée dans 'hash' pour enchaîner plusieurs
+ * images.
+ *
+ * @param img L'image à lire.
+ * @param w Largeur de l'image en pixels.
+ * @param h Hauteur de l'image en pixels.
+ * @param hash L'empreinte de départ (FNV_OFFSET pour une première image).
+ * @return L'empreinte mise à jour.
+ */
+unsigned long long	frame_hash(t_ImageControl *img, int w, int h,
+			unsigned long long hash)
+{
+	unsigned int	*row;
+	int				x;
+	int				y;
+
+	y = 0;
+	while (y < h)
+	{
+		row = (unsigned int *)(img->addr + y * img->len);
+		x = 0;
+		while (x < w)
+		{
+			hash = (hash ^ row[x]) * FNV_PRIME;
+			x++;
+		}
+		y++;
+	}
+	return (hash);
+}
+
+/**
+ * @brief Affiche le résultat de la relecture et termine le programme.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+static void	replay_finish(t_Cub3d *cub)
+{
+	t_Replay	*r;
+	double		secs;
+
+	r = cub->replay;
+	secs = (get_time_ns() - r->start_ns) / 1e9;
+	printf("replay: %lld ticks, %lld frames in %.3f s, %.1f fps\n",
+		cub->sim->ticks, r->frames, secs, r->frames / secs);
+	printf("replay: frame hash %016llx\n", r->hash);
+	free_main(cub);
+	exit(EXIT_SUCCESS);
+}
+
+/**
+ * @brief Prépare la frame suivante de la relecture.
+ *
+ * La fonction 'replay_step' est appelée au début de chaque frame de la
+ * boucle de jeu, hors des mesures du profileur. L'image de la frame
+ * précédente (vue 3D et minimap) est d'abord ajoutée à l'empreinte des
+ * frames. Quand tous les ticks enregistrés ont été simulés, le résultat est
+ * affiché et le programme se termine; sinon, le nombre de ticks de la frame
+ * est fixé pour 'sim_update'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	replay_step(t_Cub3d *cub)
+{
+	t_Replay	*r;
+	long long	left;
+
+	r = cub->replay;
+	if (!r || r->mode != REPLAY_PLAY)
+		return ;
+	if (r->frames)
+	{
+		r->hash = frame_hash(cub->img, cub->win->width, cub->win->height,
+				r->hash);
+		r->hash = frame_hash(cub->minimap->img, cub->minimap->width,
+				cub->minimap->height, r->hash);
+	}
+	left = r->end_tick - cub->sim->ticks;
+	if (!r->has_next && left <= 0)
+		replay_finish(cub);
+	r->due = r->step;
+	if (!r->has_next && left < r->step)
+		r->due = left;
+	r->frames++;
+}
@@ -0,0 +1,148 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie les deux états à interpoler et le coefficient associé.
+ *
+ * En mode mono-thread, la fonction 'sim_snapshot' renvoie directement les
+ * deux derniers états et le reste de l'accumulateur. En mode multi-thread,
+ * elle récupère le tampon du milieu s'il a été publié depuis la dernière
+ * lecture, puis calcule le coefficient à partir du temps écoulé depuis le
+ * dernier tick publié.
+ *
+ * @param s Pointeur vers la structure de simulation.
+ * @param a Reçoit l'avant-dernier état.
+ * @param b Reçoit le dernier état.
+ * @return Le coefficient d'interpolation, entre 0 et 1.
+ */
+double	sim_snapshot(t_Simulation *s, t_SimState **a, t_SimState **b)
+{
+	double	t;
+
+	if (!s->threaded)
+	{
+		*a = &s->prev;
+		*b = &s->cur;
+		return (s->alpha);
+	}
+	if (atomic_load(&s->middle) & SNAP_NEW)
+		s->front = atomic_exchange(&s->middle, s->front) & SNAP_MASK;
+	*a = &s->slots[s->front].prev;
+	*b = &s->slots[s->front].cur;
+	t = (double)(get_time_ns() - (*b)->time_ns) / s->tick_ns;
+	if (t > 1.0)
+		t = 1.0;
+	if (t < 0.0)
+		t = 0.0;
+	return (t);
+}
+
+/**
+ * @brief Exécute les ticks dont l'échéance est passée et publie l'état
+ * après chacun d'eux.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param next L'échéance du prochain tick (ns).
+ * @return L'échéance du tick suivant le dernier tick exécuté (ns).
+ */
+static long long	sim_catch_up(t_Cub3d *cub, long long next)
+{
+	t_Simulation	*s;
+
+	s = cub->sim;
+	while (next <= get_time_ns())
+	{
+		s->prev = s->cur;
+		sim_tick(cub);
+		capture_state(cub, &s->cur);
+		sim_publish(cub);
+		next += s->tick_ns;
+	}
+	return (next);
+}
+
+/**
+ * @brief Boucle du thread de simulation.
+ *
+ * La fonction 'sim_thread_main' exécute les ticks fixes à leur échéance et
+ * publie l'état après chacun d'eux ('sim_catch_up'), puis dort jusqu'au tick
+ * suivant. Si le thread prend plus de SIM_MAX_TICKS ticks de retard,
+ * l'échéance est recalée pour éviter une rafale de ticks.
+ *
+ * @param arg Pointeur vers la structure principale du jeu.
+ * @return Toujours NULL.
+ */
+static void	*sim_thread_main(void *arg)
+{
+	t_Cub3d			*cub;
+	t_Simulation	*s;
+	long long		next;
+	struct timespec	ts;
+
+	cub = arg;
+	s = cub->sim;
+	next = get_time_ns();
+	while (atomic_load(&s->running))
+	{
+		if (get_time_ns() - next > SIM_MAX_TICKS * s->tick_ns)
+			next = get_time_ns();
+		next = sim_catch_up(cub, next);
+		ts.tv_sec = 0;
+		ts.tv_nsec = next - get_time_ns();
+		if (ts.tv_nsec > 0 && ts.tv_nsec < 1000000000LL)
+			nanosleep(&ts, NULL);
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Démarre ou reprend la simulation au début de la partie.
+ *
+ * La fonction 'sim_start' remet l'accumulateur à zéro pour que le temps passé
+ * dans le menu ne soit pas simulé. Si le mode multi-thread est demandé, elle
+ * donne au thread sa copie de la carte ('sim_world'), publie l'état initial
+ * puis lance le thread de simulation; en cas d'échec d'allocation ou de
+ * création du thread, la simulation reste sur le thread principal.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param threaded true pour exécuter la simulation sur son propre thread.
+ */
+void	sim_start(t_Cub3d *cub, bool threaded)
+{
+	t_Simulation	*s;
+
+	s = cub->sim;
+	s->last_ns = get_time_ns();
+	s->acc = 0;
+	if (!threaded || s->threaded)
+		return ;
+	s->back = 0;
+	s->front = 1;
+	atomic_store(&s->middle, 2);
+	if (!sim_world(cub))
+	{
+		sim_publish(cub);
+		atomic_store(&s->running, 1);
+		if (!pthread_create(&s->thread, NULL, sim_thread_main, cub))
+		{
+			s->threaded = true;
+			return ;
+		}
+		atomic_store(&s->running, 0);
+	}
+	sim_world_free(cub);
+}
+
+/**
+ * @brief Arrête le thread de simulation s'il est actif.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_stop(t_Cub3d *cub)
+{
+	if (!cub->sim || !cub->sim->threaded)
+		return ;
+	atomic_store(&cub->sim->running, 0);
+	pthread_join(cub->sim->thread, NULL);
+	cub->sim->threaded = false;
+	sim_world_free(cub);
+}
@@ -0,0 +1,142 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Alloue les trois tampons de publication de l'état des portes.
+ *
+ * Chaque tampon part de l'état des portes de 'matrix', pour que le rendu
+ * ne lise jamais un tampon vide avant la première publication.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 si une allocation échoue.
+ */
+static int	sim_door_slots(t_Cub3d *cub)
+{
+	t_Door	*d;
+	int		i;
+	int		j;
+
+	i = -1;
+	while (++i < 3)
+	{
+		cub->sim->doors[i] = ft_calloc(cub->map->n_doors + 1, sizeof(char));
+		if (!cub->sim->doors[i])
+			return (1);
+		j = -1;
+		while (++j < cub->map->n_doors)
+		{
+			d = &cub->map->doors[j];
+			cub->sim->doors[i][j] = cub->map->matrix[d->y][d->x];
+		}
+	}
+	return (0);
+}
+
+/**
+ * @brief Donne au thread de simulation sa propre copie de la carte.
+ *
+ * Avec '--sim-thread', la simulation ne lit ni n'écrit plus 'matrix', que
+ * le rendu lit en même temps: elle joue sur 'world', une copie dont elle
+ * est seule propriétaire. Les portes ouvertes ou refermées par la
+ * simulation sont publiées avec chaque état ('sim_publish') et recopiées
+ * dans 'matrix' par le thread principal ('sim_doors').
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 si une allocation échoue.
+ */
+int	sim_world(t_Cub3d *cub)
+{
+	t_MapConfig	*m;
+	int			i;
+
+	m = cub->map;
+	m->world = ft_calloc(m->n_lines + 2, sizeof(char *));
+	if (!m->world)
+		return (1);
+	i = -1;
+	while (++i <= m->n_lines && m->matrix[i])
+	{
+		m->world[i] = ft_strdup(m->matrix[i]);
+		if (!m->world[i])
+			return (1);
+	}
+	return (sim_door_slots(cub));
+}
+
+/**
+ * @brief Libère la copie de la carte du thread de simulation.
+ *
+ * La simulation rejoue ensuite sur 'matrix', qui porte déjà l'état des
+ * portes publié en dernier.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_world_free(t_Cub3d *cub)
+{
+	int	i;
+
+	i = -1;
+	while (++i < 3)
+	{
+		free(cub->sim->doors[i]);
+		cub->sim->doors[i] = NULL;
+	}
+	if (cub->map->world == cub->map->matrix)
+		return ;
+	i = 0;
+	while (cub->map->world && cub->map->world[i])
+		free(cub->map->world[i++]);
+	free(cub->map->world);
+	cub->map->world = cub->map->matrix;
+}
+
+/**
+ * @brief Publie les deux derniers états de la simulation sans verrou.
+ *
+ * La fonction 'sim_publish' utilise un triple tampon: le thread de simulation
+ * écrit dans son tampon arrière, avec l'état des portes de sa carte, puis
+ * l'échange atomiquement avec le tampon du milieu en le marquant comme
+ * nouveau (SNAP_NEW). Le rendu ne lit jamais le tampon arrière, aucun verrou
+ * n'est donc nécessaire: l'échange atomique ordonne les écritures du tampon
+ * avant sa lecture par le rendu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_publish(t_Cub3d *cub)
+{
+	t_Simulation	*s;
+	t_Door			*d;
+	int				i;
+
+	s = cub->sim;
+	s->slots[s->back].prev = s->prev;
+	s->slots[s->back].cur = s->cur;
+	i = -1;
+	while (++i < cub->map->n_doors)
+	{
+		d = &cub->map->doors[i];
+		s->doors[s->back][i] = cub->map->world[d->y][d->x];
+	}
+	s->back = atomic_exchange(&s->middle, s->back | SNAP_NEW) & SNAP_MASK;
+}
+
+/**
+ * @brief Recopie dans la carte du rendu l'état des portes publié.
+ *
+ * Appelée par le thread principal avant le lancer de rayons, avec le
+ * tampon de lecture ('front'): le thread principal est le seul à écrire
+ * dans 'matrix'.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_doors(t_Cub3d *cub)
+{
+	t_Door	*d;
+	int		i;
+
+	i = -1;
+	while (++i < cub->map->n_doors)
+	{
+		d = &cub->map->doors[i];
+		cub->map->matrix[d->y][d->x] = cub->sim->doors[cub->sim->front][i];
+	}
+}
@@ -0,0 +1,158 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Capture l'état de la simulation utile au rendu.
+ *
+ * La fonction 'capture_state' copie la position et la direction du joueur,
+ * le plan de la caméra, l'image courante de l'animation du pistolet et le
+ * compteur des changements de porte dans un instantané 't_SimState',
+ * horodaté avec l'horloge monotone.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param s Pointeur vers l'instantané à remplir.
+ */
+void	capture_state(t_Cub3d *cub, t_SimState *s)
+{
+	s->pos_x = cub->player->pos_x;
+	s->pos_y = cub->player->pos_y;
+	s->dir_x = cub->player->dir_x;
+	s->dir_y = cub->player->dir_y;
+	s->plane_x = cub->cam->plane_x;
+	s->plane_y = cub->cam->plane_y;
+	s->gun_frame = cub->player->gun_frame;
+	s->doors = cub->map->door_changes;
+	s->time_ns = get_time_ns();
+}
+
+/**
+ * @brief Exécute un pas fixe de la simulation.
+ *
+ * La fonction 'sim_tick' fait avancer le monde d'exactement un tick:
+ * lecture des entrées ('sim_input'), déplacements et rotations du joueur, actions d'utilisation, fermeture des
+ * portes éloignées et animation du pistolet. Comme la durée d'un tick est
+ * constante, le résultat ne dépend ni de la vitesse de rendu ni de la
+ * machine.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_tick(t_Cub3d *cub)
+{
+	prof_begin(cub->prof, PROF_MOVE);
+	sim_input(cub);
+	readmove(cub, cub->player);
+	prof_end(cub->prof, PROF_MOVE);
+	prof_begin(cub->prof, PROF_DOORS);
+	restore_doors(cub);
+	prof_end(cub->prof, PROF_DOORS);
+	gun_animation_tick(cub->player);
+	cub->sim->ticks++;
+}
+
+/**
+ * @brief Initialise la simulation à pas fixe.
+ *
+ * La fonction 'sim_init' alloue la structure 't_Simulation', calcule la durée
+ * d'un tick à partir de la fréquence demandée et le facteur de vitesse
+ * correspondant ('step_scale', 1.0 pour un tick de 1/REF_FPS seconde), ainsi
+ * que le cosinus et le sinus de la rotation d'un tick au clavier.
+ * Les deux derniers états de la simulation sont initialisés avec la pose de
+ * départ du joueur, et la simulation joue sur la carte du rendu tant
+ * qu'elle reste sur le thread principal.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param hz La fréquence de la simulation en ticks par seconde.
+ * @return 0 en cas de succès, 1 si l'allocation échoue.
+ */
+int	sim_init(t_Cub3d *cub, int hz)
+{
+	cub->sim = ft_calloc(1, sizeof(t_Simulation));
+	if (!cub->sim)
+		return (1);
+	if (hz <= 0)
+		hz = SIM_HZ;
+	cub->sim->tick_ns = 1000000000LL / hz;
+	cub->sim->step_scale = REF_FPS / hz;
+	cub->sim->rot_cos = cos(ROT_SPEED * cub->sim->step_scale);
+	cub->sim->rot_sin = sin(ROT_SPEED * cub->sim->step_scale);
+	cub->map->world = cub->map->matrix;
+	capture_state(cub, &cub->sim->cur);
+	cub->sim->prev = cub->sim->cur;
+	cub->sim->view = cub->sim->cur;
+	cub->sim->last_ns = get_time_ns();
+	return (0);
+}
+
+/**
+ * @brief Fait avancer la simulation mono-thread jusqu'à l'instant présent.
+ *
+ * La fonction 'sim_update' ajoute le temps écoulé depuis l'appel précédent à
+ * un accumulateur, puis exécute autant de ticks fixes que l'accumulateur en
+ * contient. Le reste sert de coefficient d'interpolation ('alpha') entre les
+ * deux derniers états. Le retard est borné à SIM_MAX_TICKS ticks pour qu'une
+ * pause (menu, fenêtre déplacée) ne provoque pas une rafale de ticks.
+ * Pendant la relecture d'un enregistrement, le temps écoulé est ignoré: chaque
+ * frame simule exactement le nombre de ticks prévu par 'replay_step', pour que
+ * les frames rendues ne dépendent pas de la vitesse de la machine.
+ * En mode multi-thread, la simulation tourne sur son propre thread et cette
+ * fonction ne fait rien.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_update(t_Cub3d *cub)
+{
+	t_Simulation	*s;
+	long long		now;
+
+	s = cub->sim;
+	if (s->threaded)
+		return ;
+	now = get_time_ns();
+	s->acc += now - s->last_ns;
+	s->last_ns = now;
+	if (cub->replay && cub->replay->mode == REPLAY_PLAY)
+		s->acc = cub->replay->due * s->tick_ns;
+	else if (s->acc > SIM_MAX_TICKS * s->tick_ns)
+		s->acc = SIM_MAX_TICKS * s->tick_ns;
+	while (s->acc >= s->tick_ns)
+	{
+		s->prev = s->cur;
+		sim_tick(cub);
+		capture_state(cub, &s->cur);
+		s->acc -= s->tick_ns;
+	}
+	s->alpha = (double)s->acc / s->tick_ns;
+}
+
+/**
+ * @brief Calcule la pose interpolée utilisée par le rendu.
+ *
+ * La fonction 'sim_view' interpole linéairement la position, la direction et
+ * le plan de la caméra entre les deux derniers ticks de la simulation, puis
+ * stocke le résultat dans 'cub->sim->view'. Le rendu ne lit que cette vue, il
+ * ne touche jamais à l'état du joueur manipulé par la simulation. Avec
+ * '--sim-thread', l'état des portes publié avec la vue est recopié dans la
+ * carte du rendu ('sim_doors').
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	sim_view(t_Cub3d *cub)
+{
+	t_SimState	*a;
+	t_SimState	*b;
+	t_SimState	*v;
+	double		t;
+
+	t = sim_snapshot(cub->sim, &a, &b);
+	if (cub->sim->threaded)
+		sim_doors(cub);
+	v = &cub->sim->view;
+	v->pos_x = a->pos_x + (b->pos_x - a->pos_x) * t;
+	v->pos_y = a->pos_y + (b->pos_y - a->pos_y) * t;
+	v->dir_x = a->dir_x + (b->dir_x - a->dir_x) * t;
+	v->dir_y = a->dir_y + (b->dir_y - a->dir_y) * t;
+	v->plane_x = a->plane_x + (b->plane_x - a->plane_x) * t;
+	v->plane_y = a->plane_y + (b->plane_y - a->plane_y) * t;
+	v->gun_frame = b->gun_frame;
+	v->doors = b->doors;
+	v->time_ns = b->time_ns;
+}
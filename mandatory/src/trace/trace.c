@@ -0,0 +1,111 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Prépare la chronologie des frames de l'option '--trace'.
+ *
+ * L'anneau des événements est alloué et mis à zéro dès le démarrage, pour
+ * qu'enregistrer un événement ne fasse jamais ni allocation ni défaut de
+ * page. Elle est appelée juste après l'analyse des options, afin de couvrir
+ * le chargement de la carte et des textures.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @return 0 en cas de succès, 1 en cas d'échec d'allocation.
+ */
+int	trace_init(t_Cub3d *cub)
+{
+	t_Trace	*t;
+
+	if (!cub->opt->trace)
+		return (0);
+	t = ft_calloc(1, sizeof(t_Trace));
+	cub->trace = t;
+	if (!t)
+		return (1);
+	t->ring = ft_calloc(TRACE_EVENTS, sizeof(t_TraceEvent));
+	if (!t->ring)
+		return (1);
+	t->path = cub->opt->trace;
+	t->pid = getpid();
+	t->frame = -1;
+	t->t0 = get_time_ns();
+	trace_signals(t);
+	return (0);
+}
+
+/**
+ * @brief Copie la précision d'un événement dans sa case de l'anneau.
+ *
+ * Seuls les TRACE_DETAIL - 1 derniers caractères sont gardés. Les
+ * guillemets, barres obliques inverses et caractères de contrôle sont
+ * remplacés par '_' pour que le JSON reste valide.
+ *
+ * @param dst La précision de la case, TRACE_DETAIL octets.
+ * @param src La précision à copier, ou NULL.
+ */
+static void	trace_detail(char *dst, const char *src)
+{
+	size_t	len;
+	int		i;
+
+	len = 0;
+	if (src)
+		len = ft_strlen(src);
+	if (len > TRACE_DETAIL - 1)
+		src += len - (TRACE_DETAIL - 1);
+	i = 0;
+	while (src && src[i])
+	{
+		dst[i] = src[i];
+		if (src[i] == '"' || src[i] == '\\' || (unsigned char)src[i] < ' ')
+			dst[i] = '_';
+		i++;
+	}
+	dst[i] = '\0';
+}
+
+/**
+ * @brief Enregistre un événement dans la chronologie.
+ *
+ * Peut être appelée depuis n'importe quel thread: la case de l'événement
+ * est réservée par un compteur atomique, puis remplie sans verrou.
+ *
+ * @param t Pointeur vers la chronologie, ou NULL sans '--trace'.
+ * @param name Nom de l'événement, une chaîne constante.
+ * @param ph 'B' pour un début, 'E' pour une fin.
+ * @param detail Précision de l'événement, ou NULL.
+ */
+void	trace_event(t_Trace *t, const char *name, char ph, const char *detail)
+{
+	t_TraceEvent	*e;
+
+	if (!t)
+		return ;
+	e = &t->ring[atomic_fetch_add(&t->head, 1) % TRACE_EVENTS];
+	e->name = name;
+	e->ts = get_time_ns() - t->t0;
+	e->frame = atomic_load(&t->frame);
+	e->tid = syscall(SYS_gettid);
+	e->ph = ph;
+	trace_detail(e->detail, detail);
+}
+
+/**
+ * @brief Écrit la chronologie sur le disque et la libère.
+ *
+ * Appelée par 'free_main' une fois les threads de simulation et de capture
+ * arrêtés; les signaux retrouvent leur traitement par défaut.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	trace_close(t_Cub3d *cub)
+{
+	if (!cub->trace)
+		return ;
+	signal(SIGINT, SIG_DFL);
+	signal(SIGTERM, SIG_DFL);
+	if (cub->trace->ring)
+		trace_flush(cub->trace);
+	free(cub->trace->ring);
+	free(cub->trace);
+	cub->trace = NULL;
+}
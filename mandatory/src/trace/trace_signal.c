@@ -0,0 +1,68 @@
+#include "../../headers/cub3d.h"
+
+/**
+ * @brief Renvoie le drapeau levé par SIGINT et SIGTERM avec '--trace'.
+ *
+ * Le gestionnaire de signal n'a pas accès à 'cub': le drapeau est une
+ * variable statique de la fonction, que 'trace_signals' range dans la
+ * chronologie pour le reste du programme.
+ *
+ * @return L'adresse du drapeau: le numéro du signal reçu, ou 0.
+ */
+static volatile sig_atomic_t	*trace_stop_flag(void)
+{
+	static volatile sig_atomic_t	sig;
+
+	return (&sig);
+}
+
+/**
+ * @brief Note la réception de SIGINT ou SIGTERM.
+ *
+ * Le gestionnaire ne fait que lever le drapeau et rendre au signal son
+ * traitement par défaut: l'écriture de la chronologie n'est pas
+ * async-signal-safe et se fait dans la boucle ('trace_poll'). Un second
+ * Ctrl-C termine donc aussitôt un programme bloqué.
+ *
+ * @param sig Le signal reçu (SIGINT ou SIGTERM).
+ */
+static void	trace_signal(int sig)
+{
+	*trace_stop_flag() = sig;
+	signal(sig, SIG_DFL);
+}
+
+/**
+ * @brief Installe le gestionnaire de SIGINT et SIGTERM de '--trace'.
+ *
+ * @param t Pointeur vers la chronologie.
+ */
+void	trace_signals(t_Trace *t)
+{
+	t->stop = trace_stop_flag();
+	signal(SIGINT, trace_signal);
+	signal(SIGTERM, trace_signal);
+}
+
+/**
+ * @brief Écrit la chronologie puis termine le programme si un signal a été
+ * reçu.
+ *
+ * Appelée au début de chaque frame par 'gameloop' et le banc d'essai. Un
+ * Ctrl-C pendant un démarrage trop long garde ainsi sa chronologie: elle
+ * est écrite par 'free_main', puis le signal est renvoyé avec son
+ * traitement par défaut.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ */
+void	trace_poll(t_Cub3d *cub)
+{
+	int	sig;
+
+	if (!cub->trace || !cub->trace->stop || !*cub->trace->stop)
+		return ;
+	sig = *cub->trace->stop;
+	free_main(cub);
+	signal(sig, SIG_DFL);
+	raise(sig);
+}
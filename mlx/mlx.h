@@ -38,6 +38,21 @@ void	*mlx_init();
 **  return (void *)0 if failed
 */
 
+void	*mlx_init_backend(int backend);
+/*
+**  same as mlx_init, with the backend chosen by the caller :
+**   MLX_BACKEND_X11  : mlx_init, needs a live X display.
+**   MLX_BACKEND_NULL : no X server at all. Images are plain heap buffers
+**                      with the same bpp / size_line layout (32 bpp),
+**                      windows are bookkeeping only and record the images
+**                      put to them, XPM loading works, hooks other than
+**                      loop_hook never fire, and mlx_loop calls loop_hook
+**                      on a timer (MLX_NULL_HZ, see mlx_null_set_rate).
+*/
+
+# define MLX_BACKEND_X11	0
+# define MLX_BACKEND_NULL	1
+
 
 /*
 ** Basic actions
@@ -47,6 +62,12 @@ void	*mlx_new_window(void *mlx_ptr, int size_x, int size_y, char *title);
 /*
 **  return void *0 if failed
 */
+int	mlx_window_resizable(void *mlx_ptr, void *win_ptr, int min_x, int min_y);
+/*
+**  windows are created with a fixed size ; this lets the window manager
+**  resize win_ptr, down to min_x * min_y. The new size is reported by
+**  a ConfigureNotify (22) hook, see below. No-op with MLX_BACKEND_NULL.
+*/
 int	mlx_clear_window(void *mlx_ptr, void *win_ptr);
 int	mlx_pixel_put(void *mlx_ptr, void *win_ptr, int x, int y, int color);
 /*
@@ -88,6 +109,33 @@ int	mlx_expose_hook (void *win_ptr, int (*funct_ptr)(), void *param);
 int	mlx_loop_hook (void *mlx_ptr, int (*funct_ptr)(), void *param);
 int	mlx_loop (void *mlx_ptr);
 int mlx_loop_end (void *mlx_ptr);
+int	mlx_loop_ex (void *mlx_ptr, int sync_policy, int sync_every);
+int	mlx_wait_event (void *mlx_ptr, int timeout_ms);
+
+/*
+**  mlx_loop_ex sync_policy, applied once per frame before loop_hook :
+**   MLX_SYNC_FLUSH : only flush the request buffer, no round-trip.
+**   MLX_SYNC_EVERY : XSync every sync_every frames, flush otherwise.
+**   MLX_SYNC_SHM   : wait for the ShmCompletion of the images put during
+**                    the previous frame (falls back to flush without XShm).
+**  mlx_loop is mlx_loop_ex(mlx_ptr, MLX_SYNC_EVERY, 1).
+**
+**  mlx_wait_event : sleeps until an event is readable on the X connection
+**  or timeout_ms expires (-1 = no timeout). Returns 1 if an event is ready.
+*/
+
+# define MLX_SYNC_FLUSH	0
+# define MLX_SYNC_EVERY	1
+# define MLX_SYNC_SHM	2
+
+int	mlx_null_set_rate(void *mlx_ptr, int hz);
+int	mlx_window_presents(void *win_ptr, void **img_ptr);
+/*
+**  mlx_null_set_rate : loop_hook calls per second of the null backend
+**  loop, 0 to call it back to back. Ignored by the X11 backend.
+**  mlx_window_presents : number of mlx_put_image_to_window on win_ptr ;
+**  if img_ptr is not NULL, it receives the last image put.
+*/
 
 /*
 **  hook funct are called as follow :
@@ -96,6 +144,8 @@ int mlx_loop_end (void *mlx_ptr);
 **   key_hook(int keycode, void *param);
 **   mouse_hook(int button, int x,int y, void *param);
 **   loop_hook(void *param);
+**   configure_hook(int width, int height, void *param);
+**     ( mlx_hook(win_ptr, 22, 1L<<17, funct_ptr, param) )
 **
 */
 
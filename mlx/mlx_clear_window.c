@@ -15,6 +15,8 @@
 
 int		mlx_clear_window(t_xvar *xvar,t_win_list *win)
 {
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (0);
   XClearWindow(xvar->display,win->window);
   if (xvar->do_flush)
     XFlush(xvar->display);
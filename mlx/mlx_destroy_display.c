@@ -14,5 +14,7 @@
 
 int	mlx_destroy_display(t_xvar *xvar)
 {
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (0);
 	XCloseDisplay(xvar->display);
 }
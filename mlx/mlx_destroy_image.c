@@ -14,6 +14,12 @@
 
 int	mlx_destroy_image(t_xvar *xvar, t_img *img)
 {
+  if (img->type == MLX_TYPE_HEAP)
+    {
+      free(img->data);
+      free(img);
+      return (0);
+    }
   if (img->type == MLX_TYPE_SHM_PIXMAP ||
       img->type == MLX_TYPE_SHM)
     {
@@ -30,6 +30,13 @@ int	mlx_destroy_window(t_xvar *xvar,t_win_list *win)
       w = w->next;
     }
   xvar->win_list = first.next;
+  if (xvar->last_win==win)
+    xvar->last_win = 0;
+  if (xvar->backend == MLX_BACKEND_NULL)
+    {
+      free(win);
+      return (0);
+    }
   XDestroyWindow(xvar->display,win->window);
   XFreeGC(xvar->display,win->gc);
   free(win);
@@ -18,6 +18,8 @@ int	mlx_flush_event(t_xvar *xvar)
 {
   XEvent	ev;
 
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (0);
   while (XPending(xvar->display))
   {
      XNextEvent(xvar->display,&ev);
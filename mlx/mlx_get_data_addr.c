@@ -16,8 +16,14 @@
 char	*mlx_get_data_addr(t_img *img,int *bits_per_pixel,
 			   int *size_line,int *endian)
 {
+  int	one;
+
+  one = 1;
   *bits_per_pixel = img->bpp;
   *size_line = img->size_line;
-  *endian = img->image->byte_order;
+  if (img->type == MLX_TYPE_HEAP)
+    *endian = !*(char *)&one;
+  else
+    *endian = img->image->byte_order;
   return (img->data);
 }
@@ -25,16 +25,22 @@ int	mlx_hook(t_win_list *win, int x_event, int x_mask,
 
 int	mlx_do_key_autorepeatoff(t_xvar *xvar)
 {
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (0);
   XAutoRepeatOff(xvar->display);
 }
 
 int	mlx_do_key_autorepeaton(t_xvar *xvar)
 {
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (0);
   XAutoRepeatOn(xvar->display);
 }
 
 
 int	mlx_do_sync(t_xvar *xvar)
 {
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (0);
   XSync(xvar->display, False);
 }
@@ -45,10 +45,32 @@ void	*mlx_init()
 				 xvar->visual,AllocNone);
 	mlx_int_rgb_conversion(xvar);
 	xvar->end_loop = 0;
+	xvar->sync_policy = MLX_SYNC_FLUSH;
+	xvar->sync_every = 1;
+	xvar->frame_count = 0;
+	xvar->frame_put = 0;
+	xvar->shm_event = 0;
+	xvar->shm_pending = 0;
+	xvar->last_win = 0;
+	xvar->backend = MLX_BACKEND_X11;
+	xvar->null_tick_ns = 0;
+	xvar->null_next_id = 0;
 	return (xvar);
 }
 
 
+void	*mlx_init_backend(int backend)
+{
+	t_xvar	*xvar;
+
+	if (backend != MLX_BACKEND_NULL)
+		return (mlx_init());
+	if (!(xvar = malloc(sizeof(*xvar))))
+		return ((void*)0);
+	return (mlx_int_null_init(xvar));
+}
+
+
 /*
 ** pshm_format of -1 :	Not XYBitmap|XYPixmap|ZPixmap
 ** alpha libX need a check of the DISPLAY env var, or shm is allowed
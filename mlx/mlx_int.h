@@ -30,15 +30,26 @@
 # include <sys/shm.h>
 # include <X11/extensions/XShm.h>
 # include <X11/XKBlib.h>
+# include <poll.h>
 /* #include	<X11/xpm.h> */
 
 
 # define MLX_TYPE_SHM_PIXMAP 3
 # define MLX_TYPE_SHM 2
 # define MLX_TYPE_XIMAGE 1
+# define MLX_TYPE_HEAP 4
 
 # define MLX_MAX_EVENT LASTEvent
 
+/* same values as in mlx.h */
+# define MLX_SYNC_FLUSH	0
+# define MLX_SYNC_EVERY	1
+# define MLX_SYNC_SHM	2
+# define MLX_BACKEND_X11	0
+# define MLX_BACKEND_NULL	1
+
+# define MLX_NULL_HZ	60
+
 
 # define ENV_DISPLAY "DISPLAY"
 # define LOCALHOST "localhost"
@@ -79,6 +90,8 @@ typedef struct	s_win_list
 	void				*key_param;
 	void				*expose_param;
 	t_event_list		hooks[MLX_MAX_EVENT];
+	int					presents;
+	void				*last_img;
 }				t_win_list;
 
 
@@ -116,6 +129,16 @@ typedef struct	s_xvar
 	Atom		wm_delete_window;
 	Atom		wm_protocols;
 	int 		end_loop;
+	int			sync_policy;
+	int			sync_every;
+	int			frame_count;
+	int			frame_put;
+	int			shm_event;
+	int			shm_pending;
+	t_win_list	*last_win;
+	int			backend;
+	long long	null_tick_ns;
+	Window		null_next_id;
 }				t_xvar;
 
 
@@ -130,11 +153,17 @@ int				mlx_int_deal_shm();
 void			*mlx_int_new_xshm_image();
 char			**mlx_int_str_to_wordtab();
 void			*mlx_new_image();
+int				mlx_destroy_image();
 int				shm_att_pb();
 int				mlx_int_get_visual(t_xvar *xvar);
 int				mlx_int_set_win_event_mask(t_xvar *xvar);
 int				mlx_int_str_str_cote(char *str,char *find,int len);
 int				mlx_int_str_str(char *str,char *find,int len);
+void			*mlx_int_null_init(t_xvar *xvar);
+void			*mlx_int_null_new_window(t_xvar *xvar);
+void			*mlx_int_null_new_image(t_xvar *xvar,int width,int height);
+int				mlx_int_null_loop(t_xvar *xvar);
+int				mlx_int_null_wait(int timeout_ms);
 
 
 #endif
@@ -54,6 +54,17 @@ int	mlx_int_param_Expose(t_xvar *xvar, XEvent *ev, t_win_list *win)
 }
 
 
+/*
+** ConfigureNotify also follows a move : the hook gets the new size anyway.
+*/
+
+int	mlx_int_param_ConfigureNotify(t_xvar *xvar, XEvent *ev, t_win_list *win)
+{
+  win->hooks[ConfigureNotify].hook(ev->xconfigure.width,ev->xconfigure.height,
+				   win->hooks[ConfigureNotify].param);
+}
+
+
 int	mlx_int_param_generic(t_xvar *xvar, XEvent *ev, t_win_list *win)
 {
   win->hooks[ev->type].hook(win->hooks[ev->type].param);
@@ -83,7 +94,7 @@ int	(*(mlx_int_param_event[]))() =
   mlx_int_param_generic,
   mlx_int_param_generic,
   mlx_int_param_generic,
-  mlx_int_param_generic,
+  mlx_int_param_ConfigureNotify,   /* 22 */
   mlx_int_param_generic,
   mlx_int_param_generic,
   mlx_int_param_generic,
@@ -34,30 +34,121 @@ int			mlx_loop_end(t_xvar *xvar)
 	return (1);
 }
 
-int			mlx_loop(t_xvar *xvar)
+/*
+** One-entry cache in front of the win_list walk : nearly every event
+** targets the window that received the previous one.
+*/
+
+static t_win_list	*find_win(t_xvar *xvar, Window w)
 {
-	XEvent		ev;
 	t_win_list	*win;
 
+	if (xvar->last_win && xvar->last_win->window == w)
+		return (xvar->last_win);
+	win = xvar->win_list;
+	while (win && (win->window != w))
+		win = win->next;
+	if (win)
+		xvar->last_win = win;
+	return (win);
+}
+
+static void	dispatch_event(t_xvar *xvar, XEvent *ev)
+{
+	t_win_list	*win;
+
+	if (xvar->use_xshm && ev->type == xvar->shm_event)
+	{
+		if (xvar->shm_pending > 0)
+			xvar->shm_pending--;
+		return ;
+	}
+	win = find_win(xvar, ev->xany.window);
+	if (win && ev->type == ClientMessage && ev->xclient.message_type == xvar->wm_protocols && ev->xclient.data.l[0] == xvar->wm_delete_window && win->hooks[DestroyNotify].hook)
+		win->hooks[DestroyNotify].hook(win->hooks[DestroyNotify].param);
+	if (win && ev->type < MLX_MAX_EVENT && win->hooks[ev->type].hook)
+		mlx_int_param_event[ev->type](xvar, ev, win);
+}
+
+/*
+** Called before loop_hook, once per frame : iterations where the app put
+** no image (idle wake-ups) do not count. MLX_SYNC_SHM keeps draining
+** events until the server has read every shm image put last frame, so
+** the app never draws into a buffer the server is still copying.
+*/
+
+static void	frame_sync(t_xvar *xvar)
+{
+	XEvent	ev;
+
+	if (!xvar->frame_put)
+		return ;
+	xvar->frame_put = 0;
+	if (xvar->sync_policy == MLX_SYNC_SHM)
+	{
+		while (xvar->shm_pending > 0 && !xvar->end_loop)
+		{
+			XNextEvent(xvar->display, &ev);
+			dispatch_event(xvar, &ev);
+		}
+		XFlush(xvar->display);
+	}
+	else if (xvar->sync_policy == MLX_SYNC_EVERY
+		&& ++xvar->frame_count >= xvar->sync_every)
+	{
+		xvar->frame_count = 0;
+		XSync(xvar->display, False);
+	}
+	else
+		XFlush(xvar->display);
+}
+
+int			mlx_wait_event(t_xvar *xvar, int timeout_ms)
+{
+	struct pollfd	pfd;
+
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (mlx_int_null_wait(timeout_ms));
+	if (XPending(xvar->display))
+		return (1);
+	pfd.fd = ConnectionNumber(xvar->display);
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+	return (poll(&pfd, 1, timeout_ms) > 0);
+}
+
+int			mlx_loop_ex(t_xvar *xvar, int sync_policy, int sync_every)
+{
+	XEvent		ev;
+
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (mlx_int_null_loop(xvar));
 	mlx_int_set_win_event_mask(xvar);
 	xvar->do_flush = 0;
+	xvar->frame_count = 0;
+	xvar->shm_pending = 0;
+	xvar->sync_every = sync_every > 0 ? sync_every : 1;
+	if (sync_policy == MLX_SYNC_SHM && !xvar->use_xshm)
+		sync_policy = MLX_SYNC_FLUSH;
+	xvar->sync_policy = sync_policy;
+	if (xvar->use_xshm)
+		xvar->shm_event = XShmGetEventBase(xvar->display) + ShmCompletion;
 	while (win_count(xvar) && !xvar->end_loop)
 	{
 		while (!xvar->end_loop && (!xvar->loop_hook || XPending(xvar->display)))
 		{
-			XNextEvent(xvar->display,&ev);
-			win = xvar->win_list;
-			while (win && (win->window!=ev.xany.window))
-				win = win->next;
-
-			if (win && ev.type == ClientMessage && ev.xclient.message_type == xvar->wm_protocols && ev.xclient.data.l[0] == xvar->wm_delete_window && win->hooks[DestroyNotify].hook)
-				win->hooks[DestroyNotify].hook(win->hooks[DestroyNotify].param);
-			if (win && ev.type < MLX_MAX_EVENT && win->hooks[ev.type].hook)
-				mlx_int_param_event[ev.type](xvar, &ev, win);
+			XNextEvent(xvar->display, &ev);
+			dispatch_event(xvar, &ev);
 		}
-		XSync(xvar->display, False);
+		frame_sync(xvar);
 		if (xvar->loop_hook)
 			xvar->loop_hook(xvar->loop_param);
 	}
+	xvar->sync_policy = MLX_SYNC_FLUSH;
 	return (0);
 }
+
+int			mlx_loop(t_xvar *xvar)
+{
+	return (mlx_loop_ex(xvar, MLX_SYNC_EVERY, 1));
+}
@@ -2,6 +2,8 @@
 
 int		mlx_mouse_move(t_xvar *xvar, t_win_list *win, int x, int y)
 {
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (0);
 	XWarpPointer(xvar->display, None, win->window, 0, 0, 0, 0, x, y);
 	return (0);
 }
@@ -13,6 +15,8 @@ int		mlx_mouse_hide(t_xvar *xvar, t_win_list *win)
 	Pixmap blank;
 	XColor dummy;
 
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (0);
 	blank = XCreateBitmapFromData(xvar->display, win->window, data, 1, 1);
 	cursor = XCreatePixmapCursor(xvar->display, blank, blank, &dummy, &dummy, 0, 0);
 	XDefineCursor(xvar->display, win->window, cursor);
@@ -22,6 +26,8 @@ int		mlx_mouse_hide(t_xvar *xvar, t_win_list *win)
 
 int		mlx_mouse_show(t_xvar *xvar, t_win_list *win)
 {
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (0);
 	XUndefineCursor(xvar->display, win->window);
 }
 
@@ -42,6 +48,12 @@ int		mlx_mouse_get_pos(t_xvar *xvar, t_win_list *win, \
 	int			root_y_return;
 	unsigned	mask_return;
 
+	if (xvar->backend == MLX_BACKEND_NULL)
+	{
+		*win_x_return = 0;
+		*win_y_return = 0;
+		return (1);
+	}
 	return (XQueryPointer(xvar->display, win->window, \
 		&root_return, &child_return, &root_x_return, &root_y_return, \
 		win_x_return, win_y_return, &mask_return));
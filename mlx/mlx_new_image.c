@@ -142,6 +142,8 @@ void	*mlx_new_image(t_xvar *xvar,int width, int height)
 {
   t_img	*img;
 
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (mlx_int_null_new_image(xvar,width,height));
   if (xvar->use_xshm)
     if (img = mlx_int_new_xshm_image(xvar,width,height,ZPixmap))
       return (img);
@@ -152,6 +154,8 @@ void	*mlx_new_image2(t_xvar *xvar,int width, int height)
 {
   t_img	*img;
 
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (mlx_int_null_new_image(xvar,width,height));
   if (xvar->use_xshm)
     if (img = mlx_int_new_xshm_image(xvar,width,height,XYPixmap))
       return (img);
@@ -25,6 +25,8 @@ void	*mlx_new_window(t_xvar *xvar,int size_x,int size_y,char *title)
 	XSetWindowAttributes	xswa;
 	XGCValues				xgcv;
 
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (mlx_int_null_new_window(xvar));
 	xswa.background_pixel = 0;
 	xswa.border_pixel = -1;
 	xswa.colormap = xvar->cmap;
@@ -60,3 +62,24 @@ void	*mlx_new_window(t_xvar *xvar,int size_x,int size_y,char *title)
 	mlx_int_wait_first_expose(xvar,new_win->window);
 	return (new_win);
 }
+
+
+/*
+** Replaces the fixed size hints of mlx_new_window : the window manager
+** may now resize the window, down to min_x * min_y.
+*/
+
+int	mlx_window_resizable(t_xvar *xvar,t_win_list *win,int min_x,int min_y)
+{
+	XSizeHints	hints;
+	long		supplied;
+
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return (0);
+	XGetWMNormalHints(xvar->display,win->window,&hints,&supplied);
+	hints.min_width = min_x;
+	hints.min_height = min_y;
+	hints.flags = (hints.flags & ~PMaxSize) | PMinSize;
+	XSetWMNormalHints(xvar->display,win->window,&hints);
+	return (0);
+}
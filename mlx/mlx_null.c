@@ -0,0 +1,138 @@
+/*
+** mlx_null.c for MiniLibX in
+**
+** Null backend : the mlx.h surface without any X server.
+** Images are heap buffers laid out like a 32 bpp ZPixmap XImage,
+** windows only keep their hooks and count the images put to them,
+** and the loop calls loop_hook on a timer.
+*/
+
+
+#include	"mlx_int.h"
+#include	<time.h>
+
+
+void	*mlx_int_null_init(t_xvar *xvar)
+{
+	bzero(xvar, sizeof(*xvar));
+	xvar->backend = MLX_BACKEND_NULL;
+	xvar->depth = 24;
+	xvar->pshm_format = -1;
+	xvar->decrgb[0] = 16;
+	xvar->decrgb[1] = 8;
+	xvar->decrgb[2] = 8;
+	xvar->decrgb[3] = 8;
+	xvar->decrgb[5] = 8;
+	xvar->sync_policy = MLX_SYNC_FLUSH;
+	xvar->sync_every = 1;
+	xvar->null_tick_ns = 1000000000LL / MLX_NULL_HZ;
+	return (xvar);
+}
+
+
+void	*mlx_int_null_new_window(t_xvar *xvar)
+{
+	t_win_list	*win;
+
+	if (!(win = malloc(sizeof(*win))))
+		return ((void *)0);
+	bzero(win, sizeof(*win));
+	win->window = ++xvar->null_next_id;
+	win->next = xvar->win_list;
+	xvar->win_list = win;
+	return (win);
+}
+
+
+/*
+**  Same size as mlx_int_new_image : width+32 ( bitmap_pad=32 ), *4
+*/
+
+void	*mlx_int_null_new_image(t_xvar *xvar, int width, int height)
+{
+	t_img	*img;
+
+	if (!(img = malloc(sizeof(*img))))
+		return ((void *)0);
+	bzero(img, sizeof(*img));
+	if (!(img->data = malloc((width + 32) * height * 4)))
+	{
+		free(img);
+		return ((void *)0);
+	}
+	bzero(img->data, (width + 32) * height * 4);
+	img->size_line = width * 4;
+	img->bpp = 32;
+	img->width = width;
+	img->height = height;
+	img->format = ZPixmap;
+	img->type = MLX_TYPE_HEAP;
+	return (img);
+}
+
+
+static long long	null_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+
+/*
+** No event can ever arrive : the loop only calls loop_hook, once per
+** null_tick_ns, until every window is destroyed or mlx_loop_end.
+** A late tick resyncs instead of bursting.
+*/
+
+int	mlx_int_null_loop(t_xvar *xvar)
+{
+	long long		next;
+	long long		now;
+	struct timespec	ts;
+
+	next = null_now();
+	while (xvar->win_list && xvar->loop_hook && !xvar->end_loop)
+	{
+		xvar->frame_put = 0;
+		xvar->loop_hook(xvar->loop_param);
+		next += xvar->null_tick_ns;
+		now = null_now();
+		if (next <= now)
+		{
+			next = now;
+			continue ;
+		}
+		ts.tv_sec = (next - now) / 1000000000LL;
+		ts.tv_nsec = (next - now) % 1000000000LL;
+		nanosleep(&ts, (void *)0);
+	}
+	return (0);
+}
+
+
+int	mlx_int_null_wait(int timeout_ms)
+{
+	if (timeout_ms > 0)
+		poll((void *)0, 0, timeout_ms);
+	return (0);
+}
+
+
+int	mlx_null_set_rate(t_xvar *xvar, int hz)
+{
+	if (hz > 0)
+		xvar->null_tick_ns = 1000000000LL / hz;
+	else
+		xvar->null_tick_ns = 0;
+	return (0);
+}
+
+
+int	mlx_window_presents(t_win_list *win, void **img_ptr)
+{
+	if (img_ptr)
+		*img_ptr = win->last_img;
+	return (win->presents);
+}
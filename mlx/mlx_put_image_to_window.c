@@ -18,6 +18,11 @@ int	mlx_put_image_to_window(t_xvar *xvar,t_win_list *win,t_img *img,
 {
   GC	gc;
 
+  win->presents++;
+  win->last_img = img;
+  xvar->frame_put = 1;
+  if (xvar->backend == MLX_BACKEND_NULL)
+    return (0);
   gc = win->gc;
   if (img->gc)
     {
@@ -25,8 +30,12 @@ int	mlx_put_image_to_window(t_xvar *xvar,t_win_list *win,t_img *img,
       XSetClipOrigin(xvar->display, gc, x, y);
     }
   if (img->type==MLX_TYPE_SHM)
-    XShmPutImage(xvar->display,img->pix, win->gc, img->image,0,0,0,0,
-		 img->width,img->height,False);
+    {
+      XShmPutImage(xvar->display,img->pix, win->gc, img->image,0,0,0,0,
+		   img->width,img->height,xvar->sync_policy==MLX_SYNC_SHM);
+      if (xvar->sync_policy==MLX_SYNC_SHM)
+	xvar->shm_pending++;
+    }
   if (img->type==MLX_TYPE_XIMAGE)
     XPutImage(xvar->display,img->pix, win->gc, img->image,0,0,0,0,
 	      img->width,img->height);
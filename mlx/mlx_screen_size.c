@@ -7,6 +7,12 @@ int		mlx_get_screen_size(void *mlx_ptr, int *sizex, int *sizey)
 	t_xvar				*xvar;
 	
 	xvar = mlx_ptr;
+	if (xvar->backend == MLX_BACKEND_NULL)
+	{
+		(*sizex) = 1920;
+		(*sizey) = 1080;
+		return (0);
+	}
 	ret = XGetWindowAttributes(xvar->display, xvar->root, &xwAttr);
 	(*sizex) = xwAttr.width;
 	(*sizey) = xwAttr.height;
@@ -23,6 +23,8 @@ void	mlx_set_font(t_xvar *xvar, t_win_list *win, char *name)
 {
 	static Font		font = 0;
 
+	if (xvar->backend == MLX_BACKEND_NULL)
+		return ;
 	if (font)
 		XUnloadFont(xvar->display, font);
 	font = XLoadFont(xvar->display, name);
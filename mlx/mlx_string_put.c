@@ -18,6 +18,8 @@ int		mlx_string_put(t_xvar *xvar,t_win_list *win,
 {
    XGCValues	xgcv;
    
+   if (xvar->backend == MLX_BACKEND_NULL)
+     return (0);
    xgcv.foreground = mlx_int_get_good_color(xvar,color);
    XChangeGC(xvar->display,win->gc,GCForeground,&xgcv);
    XDrawString(xvar->display,win->window,win->gc,x,y,string,strlen(string));
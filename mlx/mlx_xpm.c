@@ -16,8 +16,7 @@ extern struct s_col_name mlx_col_name[];
 
 #define	RETURN	{ if (colors) free(colors); if (tab) free(tab); \
 		tab = (void *)0; if (colors_direct) free(colors_direct); \
-		if (img) {XDestroyImage(img->image); \
-				XFreePixmap(xvar->display,img->pix);free(img);} \
+		if (img) mlx_destroy_image(xvar,img); \
 		return ((void *)0);}
 
 
@@ -119,6 +118,11 @@ int	mlx_int_xpm_set_pixel(t_img *img, char *data, int opp, int col, int x)
 {
 	int	dec;
 	
+	if (img->type == MLX_TYPE_HEAP)
+	{
+		*(int *)(data+x*opp) = col;
+		return (0);
+	}
 	dec = opp;
   	while (dec--)
     {
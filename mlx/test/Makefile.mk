@@ -11,6 +11,10 @@ NAME= mlx-test
 SRC = main.c
 OBJ = $(SRC:%.c=%.o)
 
+NULL_NAME= mlx-null-test
+NULL_SRC = null_test.c
+NULL_OBJ = $(NULL_SRC:%.c=%.o)
+
 LFLAGS = -L.. -lmlx -L$(INCLIB) -lXext -lX11 -lm
 
 ifeq ($(UNAME), Darwin)
@@ -25,11 +29,14 @@ else
 	LFLAGS += -lbsd
 endif
 
-all: $(NAME)
+all: $(NAME) $(NULL_NAME)
 
 $(NAME): $(OBJ)
 	$(CC) -o $(NAME) $(OBJ) $(LFLAGS)
 
+$(NULL_NAME): $(NULL_OBJ)
+	$(CC) -o $(NULL_NAME) $(NULL_OBJ) $(LFLAGS)
+
 show:
 	@printf "UNAME		: $(UNAME)\n"
 	@printf "NAME  		: $(NAME)\n"
@@ -40,6 +47,6 @@ show:
 	@printf "OBJ		:\n	$(OBJ)\n"
 
 clean:
-	rm -f $(NAME) $(OBJ) *~ core *.core
+	rm -f $(NAME) $(OBJ) $(NULL_NAME) $(NULL_OBJ) *~ core *.core
 
 re: clean all
@@ -0,0 +1,75 @@
+
+/*
+** Null backend test : runs without any X server.
+** Exits with 0 if every check passed.
+*/
+
+#include	"mlx.h"
+#include	<stdio.h>
+#include	<stdlib.h>
+#include	<string.h>
+
+#define	WIN_SX		242
+#define	WIN_SY		242
+#define	IM_SX		42
+#define	IM_SY		42
+#define	LOOPS		5
+
+int	failed = 0;
+int	loops = 0;
+
+void	check(int ok, char *what)
+{
+  printf("%s : %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok)
+    failed = 1;
+}
+
+int	loop_hook(void *mlx)
+{
+  if (++loops == LOOPS)
+    mlx_loop_end(mlx);
+}
+
+int	main()
+{
+  void	*mlx;
+  void	*win;
+  void	*im;
+  void	*xpm;
+  void	*last;
+  char	*data;
+  int	bpp;
+  int	sl;
+  int	endian;
+  int	w;
+  int	h;
+
+  check((mlx = mlx_init_backend(MLX_BACKEND_NULL)) != 0, "init");
+  if (!mlx)
+    return (1);
+  check((win = mlx_new_window(mlx, WIN_SX, WIN_SY, "Null")) != 0, "window");
+  check((im = mlx_new_image(mlx, IM_SX, IM_SY)) != 0, "image");
+  data = mlx_get_data_addr(im, &bpp, &sl, &endian);
+  check(data && bpp == 32 && sl == IM_SX * 4, "image layout");
+  memset(data, 0xFF, sl * IM_SY);
+  check((xpm = mlx_xpm_file_to_image(mlx, "open.xpm", &w, &h)) != 0, "xpm");
+  check(w > 0 && h > 0, "xpm size");
+  mlx_clear_window(mlx, win);
+  mlx_pixel_put(mlx, win, 1, 1, 0xFFFFFF);
+  mlx_string_put(mlx, win, 1, 1, 0xFFFFFF, "null");
+  mlx_put_image_to_window(mlx, win, im, 0, 0);
+  mlx_put_image_to_window(mlx, win, xpm, 0, 0);
+  check(mlx_window_presents(win, &last) == 2 && last == xpm, "presents");
+  check(mlx_wait_event(mlx, 1) == 0, "wait event");
+  mlx_null_set_rate(mlx, 1000);
+  mlx_loop_hook(mlx, loop_hook, mlx);
+  mlx_loop(mlx);
+  check(loops == LOOPS, "loop");
+  mlx_destroy_image(mlx, xpm);
+  mlx_destroy_image(mlx, im);
+  mlx_destroy_window(mlx, win);
+  mlx_destroy_display(mlx);
+  free(mlx);
+  return (failed);
+}
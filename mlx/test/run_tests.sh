@@ -45,9 +45,15 @@ sigint_handler(){
 	exit 1
 }
 
+# look at test/null_test.c : the null backend needs no X server
+test_null_backend(){
+	${MAKE} -f Makefile.gen all
+	log_info "Running ./mlx-null-test"
+	./mlx-null-test
+}
+
 # look at test/main.c and run ./mlx-test to understand what this function does
 test_default_main(){
-	${MAKE} -f Makefile.gen all
 	./mlx-test &
 	PID="$!"
 	log_info "./mlx-test running in background, pid:" $PID
@@ -88,6 +94,7 @@ main(){
 	trap at_exit		EXIT
 	trap sigint_handler	INT
 
+	test_null_backend
 	test_default_main
 }
 
@@ -0,0 +1,73 @@
+#!/usr/bin/env sh
+
+# Golden-image regression run over the shipped maps.
+# Every map is rendered headless at a fixed set of poses (./cub3D --golden)
+# and compared to tests/golden/<mandatory|bonus>/<map>_NN.ppm.
+# Maps the game rejects on purpose have no golden images and must keep
+# being rejected.
+#
+#	tests/golden.sh				compare against the golden images
+#	tests/golden.sh --update	rewrite the golden images
+
+BOLD="\033[1m"
+RESET="\033[0m"
+LIGHT_RED="\033[91m"
+LIGHT_GREEN="\033[92m"
+LIGHT_CYAN="\033[96m"
+
+FAILED=0
+UPDATE=""
+LOG=$(mktemp)
+
+logging(){
+	local type=$1; shift
+	printf "${LIGHT_CYAN}${BOLD}golden${RESET} [%b] : %b\n" "$type" "$*"
+}
+log_ok(){
+	logging "${LIGHT_GREEN}ok${RESET}" "$@"
+}
+log_fail(){
+	logging "${LIGHT_RED}fail${RESET}" "$@"
+	FAILED=1
+}
+
+# run_map <binary> <golden dir> <map>
+run_map(){
+	name=$(basename "$3" .cub)
+	"$1" --golden "$2" $UPDATE "$3" > "$LOG" 2>&1
+	status=$?
+	if grep -q "^Error" "$LOG" && [ ! -e "$2/${name}_00.ppm" ]; then
+		log_ok "$3 rejected: $(grep -m1 "^Error" "$LOG")"
+		return
+	fi
+	grep "^golden:" "$LOG"
+	if [ $status -eq 0 ]; then
+		log_ok "$3"
+	else
+		grep -v "^golden:\|^bench:" "$LOG"
+		log_fail "$3"
+	fi
+}
+
+# run_tree <binary> <mandatory|bonus>
+run_tree(){
+	mkdir -p "tests/golden/$2"
+	for map in maps/$2/*.cub; do
+		run_map "$1" "tests/golden/$2" "$map"
+	done
+}
+
+main(){
+	cd "$(dirname "$0")/.."
+	[ "$1" = "--update" ] && UPDATE="--golden-update"
+	if [ ! -x ./cub3D ] || [ ! -x ./cub3D_Bonus ]; then
+		log_fail "build ./cub3D and ./cub3D_Bonus first (make all bonus)"
+		exit 1
+	fi
+	run_tree ./cub3D mandatory
+	run_tree ./cub3D_Bonus bonus
+	rm -f "$LOG"
+	exit $FAILED
+}
+
+main "$@"
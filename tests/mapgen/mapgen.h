@@ -0,0 +1,86 @@
+#ifndef MAPGEN_H
+# define MAPGEN_H
+
+# include "../../mandatory/headers/libft.h"
+
+// GÉNÉRATEUR DE CARTES
+# define MAPGEN_SIZE 33
+# define MAPGEN_MAX 100000
+# define MAPGEN_ROOM 3
+# define MAPGEN_SEED 42
+# define MAPGEN_HEAD "NO ./textures/Brick Walls/brick_64.xpm\n\
+SO ./textures/Brick Walls/gray_64.xpm\n\
+WE ./textures/Brick Walls/mossy_64.xpm\n\
+EA ./textures/Brick Walls/brown_64.xpm\n\
+F 180,180,180\nC 145,244,255\n"
+# define MAPGEN_DOOR "DO ./textures/Doors/door_32.xpm\n"
+
+/**
+ * @struct t_MapGen
+ * Paramètres et état du générateur de cartes.
+ *
+ * @param kind Le type de carte: 'maze', 'arena' ou 'doors'.
+ * @param seed État du générateur pseudo-aléatoire.
+ * @param width Largeur de la carte en cases.
+ * @param height Hauteur de la carte en cases.
+ * @param room Côté des salles de la grille de portes.
+ * @param walls Pourcentage de piliers dans une arène.
+ * @param tabs Indente chaque ligne de la carte avec une tabulation.
+ * @param bonus Ajoute la texture des portes, requise par cub3D_Bonus.
+ * @param player Orientation du joueur, placé en (1, 1).
+ * @param out Le fichier de sortie, ou NULL pour la sortie standard.
+ * @param fd Le descripteur de la sortie.
+ * @param row Tampon d'une ligne de la carte, indentation et '\n' compris.
+ * @param line Début des cases de la ligne dans 'row'.
+ * @param y Nombre de lignes de la carte déjà écrites.
+ */
+typedef struct s_MapGen
+{
+	char			*kind;
+	unsigned int	seed;
+	int				width;
+	int				height;
+	int				room;
+	int				walls;
+	bool			tabs;
+	bool			bonus;
+	char			player;
+	char			*out;
+	int				fd;
+	char			*row;
+	char			*line;
+	int				y;
+}					t_MapGen;
+
+/**
+ * @struct t_Eller
+ * État de l'algorithme d'Eller pour une rangée de cellules du labyrinthe.
+ *
+ * Les cellules d'un même ensemble sont chaînées dans une liste circulaire,
+ * de gauche à droite ('l' et 'r'). Les ensembles d'une rangée ne se
+ * croisent jamais: deux cellules voisines sont dans le même ensemble si et
+ * seulement si r[c] == c + 1, ce qui rend chaque rangée linéaire.
+ *
+ * @param n Nombre de cellules par rangée.
+ * @param l Cellule précédente de l'ensemble de chaque cellule.
+ * @param r Cellule suivante de l'ensemble de chaque cellule.
+ * @param east Passage vers la cellule de droite.
+ * @param south Passage vers la cellule du dessous.
+ */
+typedef struct s_Eller
+{
+	int		n;
+	int		*l;
+	int		*r;
+	char	*east;
+	char	*south;
+}			t_Eller;
+
+void	gen_options(t_MapGen *g, int ac, char **av);
+int		gen_rand(t_MapGen *g);
+int		gen_emit(t_MapGen *g);
+int		gen_maze(t_MapGen *g);
+int		gen_arena(t_MapGen *g);
+int		gen_doors(t_MapGen *g);
+
+#endif
@@ -0,0 +1,101 @@
+#include "mapgen.h"
+
+/**
+ * @brief Tire un nombre pseudo-aléatoire entre 0 et 32767.
+ *
+ * Générateur congruentiel linéaire: une graine donne toujours la même carte,
+ * d'une exécution et d'une machine à l'autre.
+ *
+ * @param g Pointeur vers le générateur.
+ * @return Le nombre tiré.
+ */
+int	gen_rand(t_MapGen *g)
+{
+	g->seed = g->seed * 1103515245 + 12345;
+	return ((g->seed >> 16) & 0x7FFF);
+}
+
+/**
+ * @brief Écrit la ligne courante de la carte.
+ *
+ * Le joueur est toujours placé en (1, 1), une case de sol pour chaque type
+ * de carte.
+ *
+ * @param g Pointeur vers le générateur.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+int	gen_emit(t_MapGen *g)
+{
+	ssize_t	len;
+
+	if (g->y == 1)
+		g->line[1] = g->player;
+	g->line[g->width] = '\n';
+	len = g->width + 1 + g->tabs;
+	g->y++;
+	return (write(g->fd, g->row, len) != len);
+}
+
+/**
+ * @brief Ouvre la sortie et écrit les informations de textures et de
+ * couleurs.
+ *
+ * Les textures sont celles livrées dans 'textures/', avec des chemins
+ * relatifs à la racine du dépôt, d'où le jeu doit être lancé.
+ *
+ * @param g Pointeur vers le générateur.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+static int	gen_header(t_MapGen *g)
+{
+	g->fd = STDOUT_FILENO;
+	if (g->out)
+		g->fd = open(g->out, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (g->fd < 0)
+		return (1);
+	if (write(g->fd, MAPGEN_HEAD, ft_strlen(MAPGEN_HEAD)) < 0)
+		return (1);
+	if (g->bonus && write(g->fd, MAPGEN_DOOR, ft_strlen(MAPGEN_DOOR)) < 0)
+		return (1);
+	return (write(g->fd, "\n", 1) < 0);
+}
+
+/**
+ * @brief Point d'entrée du générateur de cartes.
+ *
+ * Écrit une carte .cub valide: un labyrinthe parfait ('maze'), une arène
+ * ouverte ('arena') ou une grille de salles reliées par des portes
+ * ('doors'). La carte est écrite ligne par ligne, sans jamais être gardée
+ * entière en mémoire.
+ *
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @return EXIT_SUCCESS, ou EXIT_FAILURE si la carte n'a pas pu être écrite.
+ */
+int	main(int ac, char **av)
+{
+	t_MapGen	g;
+	int			err;
+
+	ft_bzero(&g, sizeof(t_MapGen));
+	gen_options(&g, ac, av);
+	g.row = malloc(g.width + 2);
+	err = !g.row || gen_header(&g);
+	if (!err)
+	{
+		g.row[0] = '\t';
+		g.line = g.row + g.tabs;
+		if (!ft_strncmp(g.kind, "maze", 5))
+			err = gen_maze(&g);
+		else if (!ft_strncmp(g.kind, "arena", 6))
+			err = gen_arena(&g);
+		else
+			err = gen_doors(&g);
+	}
+	if (g.out && g.fd >= 0)
+		close(g.fd);
+	free(g.row);
+	if (err)
+		printf("Error: Failed writing the map\n");
+	return (err);
+}
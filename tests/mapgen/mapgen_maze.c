@@ -0,0 +1,165 @@
+#include "mapgen.h"
+
+/**
+ * @brief Réunit les ensembles de la cellule 'c' et de sa voisine de droite.
+ *
+ * Les deux listes circulaires sont raccordées en une seule, et le mur entre
+ * les deux cellules est ouvert.
+ *
+ * @param e Pointeur vers l'état de l'algorithme d'Eller.
+ * @param c La cellule de gauche.
+ */
+static void	eller_join(t_Eller *e, int c)
+{
+	e->r[e->l[c + 1]] = e->r[c];
+	e->l[e->r[c]] = e->l[c + 1];
+	e->r[c] = c + 1;
+	e->l[c + 1] = c;
+	e->east[c] = 1;
+}
+
+/**
+ * @brief Tire les passages d'une rangée du labyrinthe.
+ *
+ * Deux cellules voisines d'ensembles différents sont réunies une fois sur
+ * deux. Puis chaque cellule garde un passage vers le bas, sauf si elle est
+ * retirée de son ensemble, ce qui n'arrive jamais à la dernière cellule
+ * d'un ensemble: chaque ensemble continue ainsi dans la rangée suivante.
+ * La dernière rangée réunit tous les ensembles et n'a aucun passage vers le
+ * bas: le labyrinthe est parfait, chaque case y est reliée à toutes les
+ * autres par un chemin unique.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param e Pointeur vers l'état de l'algorithme d'Eller.
+ * @param last Indique la dernière rangée.
+ */
+static void	eller_row(t_MapGen *g, t_Eller *e, bool last)
+{
+	int	c;
+
+	ft_bzero(e->east, e->n);
+	c = 0;
+	while (c < e->n - 1)
+	{
+		if (e->r[c] != c + 1 && (last || gen_rand(g) & 1))
+			eller_join(e, c);
+		c++;
+	}
+	c = 0;
+	while (c < e->n)
+	{
+		e->south[c] = !last;
+		if (!last && e->r[c] != c && gen_rand(g) & 1)
+		{
+			e->r[e->l[c]] = e->r[c];
+			e->l[e->r[c]] = e->l[c];
+			e->l[c] = c;
+			e->r[c] = c;
+			e->south[c] = 0;
+		}
+		c++;
+	}
+}
+
+/**
+ * @brief Écrit les deux lignes de la carte d'une rangée du labyrinthe.
+ *
+ * La première ligne contient les cellules et les murs qui les séparent, la
+ * seconde les murs du dessous, ouverts là où la rangée a un passage.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param e Pointeur vers l'état de l'algorithme d'Eller.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+static int	eller_lines(t_MapGen *g, t_Eller *e)
+{
+	int	c;
+
+	ft_memset(g->line, '1', g->width);
+	c = 0;
+	while (c < e->n)
+	{
+		g->line[2 * c + 1] = '0';
+		if (e->east[c])
+			g->line[2 * c + 2] = '0';
+		c++;
+	}
+	if (gen_emit(g))
+		return (1);
+	ft_memset(g->line, '1', g->width);
+	c = 0;
+	while (c < e->n)
+	{
+		if (e->south[c])
+			g->line[2 * c + 1] = '0';
+		c++;
+	}
+	return (gen_emit(g));
+}
+
+/**
+ * @brief Alloue l'état de l'algorithme d'Eller; chaque cellule forme son
+ * propre ensemble.
+ *
+ * @param e Pointeur vers l'état à remplir.
+ * @param n Nombre de cellules par rangée.
+ * @return 0 en cas de succès, 1 si l'allocation échoue.
+ */
+static int	eller_init(t_Eller *e, int n)
+{
+	int	c;
+
+	e->n = n;
+	e->l = malloc(sizeof(int) * n);
+	e->r = malloc(sizeof(int) * n);
+	e->east = malloc(n);
+	e->south = malloc(n);
+	if (!e->l || !e->r || !e->east || !e->south)
+		return (1);
+	c = 0;
+	while (c < n)
+	{
+		e->l[c] = c;
+		e->r[c] = c;
+		c++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Génère un labyrinthe parfait avec l'algorithme d'Eller.
+ *
+ * Le labyrinthe est produit rangée par rangée et écrit au fur et à mesure:
+ * la mémoire utilisée ne dépend que de la largeur, ce qui permet des cartes
+ * de MAPGEN_MAX x MAPGEN_MAX cases. Les cellules occupent les cases de
+ * coordonnées impaires; une largeur ou une hauteur paire ajoute une ligne ou
+ * une colonne de murs.
+ *
+ * @param g Pointeur vers le générateur.
+ * @return 0 en cas de succès, 1 en cas d'échec.
+ */
+int	gen_maze(t_MapGen *g)
+{
+	t_Eller	e;
+	int		rows;
+	int		err;
+
+	ft_bzero(&e, sizeof(t_Eller));
+	err = eller_init(&e, (g->width - 1) / 2);
+	rows = (g->height - 1) / 2;
+	ft_memset(g->line, '1', g->width);
+	err = err || gen_emit(g);
+	while (!err && g->y < 2 * rows + 1)
+	{
+		eller_row(g, &e, g->y == 2 * rows - 1);
+		err = eller_lines(g, &e);
+	}
+	ft_memset(g->line, '1', g->width);
+	while (!err && g->y < g->height)
+		err = gen_emit(g);
+	free(e.l);
+	free(e.r);
+	free(e.east);
+	free(e.south);
+	return (err);
+}
@@ -0,0 +1,121 @@
+#include "mapgen.h"
+
+/**
+ * @brief Affiche l'utilisation du générateur et termine avec une erreur.
+ *
+ * @param msg Le message d'erreur à afficher avant l'utilisation.
+ */
+static void	gen_usage(char *msg)
+{
+	printf("Error: %s\n", msg);
+	printf("Usage: ./cub3D_mapgen [--seed N] [--width N] [--height N]");
+	printf(" [--room N] [--walls N] [--tabs] [--bonus] [--player N|S|E|W]");
+	printf(" [--out file.cub] maze|arena|doors\n");
+	exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Lit la valeur numérique qui suit une option.
+ *
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ * @return La valeur entière de l'argument qui suit l'option.
+ */
+static int	gen_value(int ac, char **av, int i)
+{
+	if (i + 1 >= ac || !ft_isnumeric(av[i + 1]) || ft_atoi(av[i + 1]) < 0)
+		gen_usage("Option expects a non-negative number");
+	return (ft_atoi(av[i + 1]));
+}
+
+/**
+ * @brief Analyse une option qui prend une valeur.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ */
+static void	gen_option(t_MapGen *g, int ac, char **av, int i)
+{
+	if (!ft_strncmp(av[i], "--seed", 7))
+		g->seed = gen_value(ac, av, i);
+	else if (!ft_strncmp(av[i], "--width", 8))
+		g->width = gen_value(ac, av, i);
+	else if (!ft_strncmp(av[i], "--height", 9))
+		g->height = gen_value(ac, av, i);
+	else if (!ft_strncmp(av[i], "--room", 7))
+		g->room = gen_value(ac, av, i);
+	else if (!ft_strncmp(av[i], "--walls", 8))
+		g->walls = gen_value(ac, av, i);
+	else if (i + 1 >= ac)
+		gen_usage("Option expects a value");
+	else if (!ft_strncmp(av[i], "--out", 6))
+		g->out = av[i + 1];
+	else if (!ft_strncmp(av[i], "--player", 9) && ft_strlen(av[i + 1]) == 1
+		&& ft_strchr("NSEW", av[i + 1][0]))
+		g->player = av[i + 1][0];
+	else
+		gen_usage("Unknown option or invalid value");
+}
+
+/**
+ * @brief Vérifie les dimensions et le type de carte demandés.
+ *
+ * La grille de portes n'est lisible que par cub3D_Bonus: elle ajoute
+ * toujours la texture des portes.
+ *
+ * @param g Pointeur vers le générateur.
+ */
+static void	gen_check(t_MapGen *g)
+{
+	if (!g->kind)
+		gen_usage("Missing map kind");
+	if (ft_strncmp(g->kind, "maze", 5) && ft_strncmp(g->kind, "arena", 6)
+		&& ft_strncmp(g->kind, "doors", 6))
+		gen_usage("Map kind must be maze, arena or doors");
+	if (g->width < 3 || g->height < 3
+		|| g->width > MAPGEN_MAX || g->height > MAPGEN_MAX)
+		gen_usage("Map sides must be between 3 and 100000");
+	if (g->room < 1 || g->walls > 100)
+		gen_usage("--room expects at least 1, --walls at most 100");
+	if (!ft_strncmp(g->kind, "doors", 6))
+		g->bonus = true;
+}
+
+/**
+ * @brief Analyse la ligne de commande du générateur.
+ *
+ * Par défaut, la carte fait MAPGEN_SIZE x MAPGEN_SIZE cases, les salles de
+ * la grille de portes font MAPGEN_ROOM cases de côté, la graine est
+ * MAPGEN_SEED et le joueur regarde vers le nord.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ */
+void	gen_options(t_MapGen *g, int ac, char **av)
+{
+	int	i;
+
+	g->seed = MAPGEN_SEED;
+	g->width = MAPGEN_SIZE;
+	g->height = MAPGEN_SIZE;
+	g->room = MAPGEN_ROOM;
+	g->player = 'N';
+	i = 1;
+	while (i < ac)
+	{
+		if (!ft_strncmp(av[i], "--tabs", 7))
+			g->tabs = true;
+		else if (!ft_strncmp(av[i], "--bonus", 8))
+			g->bonus = true;
+		else if (av[i][0] != '-')
+			g->kind = av[i];
+		else
+			gen_option(g, ac, av, i++);
+		i++;
+	}
+	gen_check(g);
+}
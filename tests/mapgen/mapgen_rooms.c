@@ -0,0 +1,103 @@
+#include "mapgen.h"
+
+/**
+ * @brief Choisit une case d'arène: murs sur les bords, sol ailleurs, avec
+ * 'walls' pour cent de piliers.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param x Colonne de la case.
+ * @param y Ligne de la case.
+ * @return Le caractère de la case.
+ */
+static char	arena_cell(t_MapGen *g, int x, int y)
+{
+	if (!x || !y || x == g->width - 1 || y == g->height - 1)
+		return ('1');
+	if (g->walls && gen_rand(g) % 100 < g->walls)
+		return ('1');
+	return ('0');
+}
+
+/**
+ * @brief Choisit une case de la grille de portes.
+ *
+ * Les salles de 'room' x 'room' cases sont séparées par des murs d'une case.
+ * Chaque mur entre deux salles a une porte en son milieu, entre deux murs et
+ * deux cases de sol comme l'exige la vérification des portes. Les portes qui
+ * donneraient sur le bord de la carte sont remplacées par des murs.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param x Colonne de la case.
+ * @param y Ligne de la case.
+ * @return Le caractère de la case.
+ */
+static char	doors_cell(t_MapGen *g, int x, int y)
+{
+	int	p;
+
+	p = g->room + 1;
+	if (!x || !y || x == g->width - 1 || y == g->height - 1)
+		return ('1');
+	if (y % p == 0 && x % p == 0)
+		return ('1');
+	if (y % p == 0)
+	{
+		if (x % p == p / 2 && y + 1 < g->height - 1)
+			return ('9');
+		return ('1');
+	}
+	if (x % p == 0)
+	{
+		if (y % p == p / 2 && x + 1 < g->width - 1)
+			return ('9');
+		return ('1');
+	}
+	return ('0');
+}
+
+/**
+ * @brief Écrit une carte case par case.
+ *
+ * @param g Pointeur vers le générateur.
+ * @param cell Choisit le caractère de chaque case.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+static int	gen_cells(t_MapGen *g, char (*cell)(t_MapGen *g, int x, int y))
+{
+	int	x;
+
+	while (g->y < g->height)
+	{
+		x = 0;
+		while (x < g->width)
+		{
+			g->line[x] = cell(g, x, g->y);
+			x++;
+		}
+		if (gen_emit(g))
+			return (1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Génère une arène ouverte, avec des piliers si '--walls' est donné.
+ *
+ * @param g Pointeur vers le générateur.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+int	gen_arena(t_MapGen *g)
+{
+	return (gen_cells(g, arena_cell));
+}
+
+/**
+ * @brief Génère une grille dense de salles reliées par des portes.
+ *
+ * @param g Pointeur vers le générateur.
+ * @return 0 en cas de succès, 1 si l'écriture échoue.
+ */
+int	gen_doors(t_MapGen *g)
+{
+	return (gen_cells(g, doors_cell));
+}
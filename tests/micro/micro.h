@@ -0,0 +1,130 @@
+#ifndef MICRO_H
+# define MICRO_H
+
+# include "../../mandatory/headers/cub3d.h"
+# include <dirent.h>
+
+// MICROBENCHMARKS
+# define MICRO_MAP "maps/mandatory/valid_map.cub"
+# define MICRO_REPS 30
+# define MICRO_WARMUP 3
+# define MICRO_MIN_REPS 3
+# define MICRO_BUDGET_MS 2000
+# define MICRO_MAP_MAX_KB 1000
+# define MICRO_MAP_MAX_W 1024
+# define MICRO_GRID 64
+# define MICRO_POSES 8
+# define MICRO_WALLS_STEP 10
+# define MICRO_WALLS_MAX 40
+# define MICRO_SEED 42
+# define MICRO_TEX_MIN 16
+# define MICRO_TEX_MAX 4096
+# define MICRO_MAP_TMP "/tmp/cub3D_micro_XXXXXX.cub"
+# define MICRO_MAP_HEAD "NO ./textures/Brick Walls/redbrick_32.xpm\n\
+SO ./textures/Brick Walls/redbrick_32.xpm\n\
+WE ./textures/Brick Walls/redbrick_32.xpm\n\
+EA ./textures/Brick Walls/redbrick_32.xpm\n\
+F 220,100,0\nC 225,30,0\n\n"
+
+/**
+ * @struct t_MicroCase
+ * Un cas de microbenchmark: un noyau du jeu et le paramètre avec lequel il
+ * est mesuré.
+ *
+ * @param name Nom du noyau mesuré, utilisé par '--filter'.
+ * @param param Valeur du paramètre du cas (densité, hauteur, fichier...).
+ * @param items Nombre d'éléments traités par répétition.
+ * @param unit Unité des éléments (rayon, pixel, octet...).
+ * @param fn Exécute une répétition du noyau.
+ * @param arg Données préparées pour le noyau.
+ */
+typedef struct s_MicroCase
+{
+	char		*name;
+	char		param[64];
+	long long	items;
+	char		*unit;
+	void		(*fn)(t_Cub3d *cub, void *arg);
+	void		*arg;
+}				t_MicroCase;
+
+/**
+ * @struct t_MicroStats
+ * Résumé statistique des durées mesurées d'un cas, en nanosecondes.
+ *
+ * @param n Nombre de répétitions mesurées.
+ * @param min Durée minimale.
+ * @param p50 Durée médiane.
+ * @param p99 99e centile.
+ * @param max Durée maximale.
+ * @param mean Moyenne.
+ * @param sd Écart type.
+ */
+typedef struct s_MicroStats
+{
+	int			n;
+	long long	min;
+	long long	p50;
+	long long	p99;
+	long long	max;
+	double		mean;
+	double		sd;
+}				t_MicroStats;
+
+/**
+ * @struct t_MicroRays
+ * Données du microbenchmark du DDA.
+ *
+ * @param grid Grille synthétique de MICRO_GRID x MICRO_GRID cases, fermée
+ * par des murs.
+ * @param cams Rayons préparés jusqu'au DDA, MICRO_POSES x WINDOW_X.
+ * @param work Rayon en cours de parcours, copié depuis 'cams'.
+ * @param seed État du générateur pseudo-aléatoire des murs.
+ */
+typedef struct s_MicroRays
+{
+	t_MapConfig		*grid;
+	t_CameraConfig	*cams;
+	t_CameraConfig	work;
+	unsigned int	seed;
+}					t_MicroRays;
+
+/**
+ * @struct t_Micro
+ * État de la suite de microbenchmarks.
+ *
+ * @param cub Le jeu chargé sur la carte de référence, sans serveur X.
+ * @param map La carte de référence.
+ * @param reps Nombre maximal de répétitions mesurées par cas.
+ * @param warmup Nombre de répétitions de chauffe, non mesurées.
+ * @param budget_ns Durée au-delà de laquelle un cas s'arrête, une fois
+ * MICRO_MIN_REPS répétitions mesurées.
+ * @param map_max Taille maximale des cartes générées pour l'analyse (Ko).
+ * @param filter Préfixe des noms de noyaux à mesurer, ou NULL.
+ * @param csv Fichier CSV des résultats, ou NULL.
+ * @param times Durées des répétitions du cas en cours.
+ */
+typedef struct s_Micro
+{
+	t_Cub3d		cub;
+	char		*map;
+	int			reps;
+	int			warmup;
+	long long	budget_ns;
+	long long	map_max;
+	char		*filter;
+	FILE		*csv;
+	long long	*times;
+}				t_Micro;
+
+void	micro_options(t_Micro *m, int ac, char **av);
+int		micro_skip(t_Micro *m, char *name);
+void	micro_run(t_Micro *m, t_MicroCase *c);
+void	micro_dda(t_Micro *m);
+void	micro_texture(t_Micro *m);
+void	micro_blit(t_Micro *m);
+void	micro_upscale(t_Micro *m);
+void	micro_xpm(t_Micro *m, char *dir);
+void	micro_parse(t_Micro *m);
+
+#endif
@@ -0,0 +1,85 @@
+#include "micro.h"
+
+/**
+ * @brief Remplit le plafond et le sol de l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param arg Inutilisé.
+ */
+static void	floor_kernel(t_Cub3d *cub, void *arg)
+{
+	(void)arg;
+	render_ceilling_floor(cub);
+}
+
+/**
+ * @brief Dessine le pistolet dans l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param arg Inutilisé.
+ */
+static void	gun_kernel(t_Cub3d *cub, void *arg)
+{
+	(void)arg;
+	draw_gun(cub, cub->player, 0, 0);
+}
+
+/**
+ * @brief Dessine le réticule dans l'image du jeu.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param arg Inutilisé.
+ */
+static void	crosshair_kernel(t_Cub3d *cub, void *arg)
+{
+	(void)arg;
+	draw_crosshair(cub, cub->player, 0, 0);
+}
+
+/**
+ * @brief Mesure un noyau qui dessine dans l'image du jeu.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param c Le cas, dont seuls le nom et le noyau sont remplis.
+ * @param w Largeur de la zone parcourue par le noyau.
+ * @param h Hauteur de la zone parcourue par le noyau.
+ */
+static void	blit_case(t_Micro *m, t_MicroCase *c, int w, int h)
+{
+	if (micro_skip(m, c->name))
+		return ;
+	c->unit = "px";
+	c->arg = NULL;
+	c->items = (long long)w * h;
+	snprintf(c->param, sizeof(c->param), "%dx%d", w, h);
+	micro_run(m, c);
+}
+
+/**
+ * @brief Mesure le remplissage du plafond et du sol puis les sprites de
+ * l'interface ('draw_gun' et 'draw_crosshair').
+ *
+ * Le coût est donné par pixel parcouru: toute la fenêtre pour le plafond et
+ * le sol, toute l'image du sprite pour le pistolet et le réticule, qu'un
+ * pixel soit transparent ou non.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+void	micro_blit(t_Micro *m)
+{
+	t_MicroCase		c;
+	t_ImageControl	*gun;
+	t_ImageControl	*crosshair;
+
+	gun = m->cub.player->gun->img;
+	crosshair = m->cub.player->crosshair->img;
+	c.name = "floor";
+	c.fn = floor_kernel;
+	blit_case(m, &c, WINDOW_X, WINDOW_Y);
+	c.name = "gun";
+	c.fn = gun_kernel;
+	blit_case(m, &c, gun->width, gun->height);
+	c.name = "crosshair";
+	c.fn = crosshair_kernel;
+	blit_case(m, &c, crosshair->width, crosshair->height);
+}
@@ -0,0 +1,88 @@
+#include "micro.h"
+
+/**
+ * @brief Charge le jeu sur la carte de référence, sans serveur X.
+ *
+ * La carte est analysée et les graphismes initialisés comme en mode banc
+ * d'essai: MiniLibX utilise son backend nul, les images sont des tampons en
+ * mémoire. La simulation fournit la pose de départ utilisée par les rayons.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+static void	micro_fixture(t_Micro *m)
+{
+	t_Cub3d	*cub;
+
+	cub = &m->cub;
+	cub->opt = ft_calloc(1, sizeof(t_Options));
+	if (!cub->opt)
+	{
+		printf("Error: fatal: t_Options not created\n");
+		exit(EXIT_FAILURE);
+	}
+	cub->opt->bench = true;
+	cub->opt->map_file = m->map;
+	if (map_init(cub, m->map) || graphics(cub) || sim_init(cub, SIM_HZ))
+	{
+		free_main(cub);
+		printf("Error: Failed loading %s\n", m->map);
+		exit(EXIT_FAILURE);
+	}
+}
+
+/**
+ * @brief Affiche l'en-tête des résultats et celui du fichier CSV.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+static void	micro_header(t_Micro *m)
+{
+	printf("micro: %s, %dx%d, up to %d reps after %d warmup, %lld ms budget\n",
+		m->map, WINDOW_X, WINDOW_Y, m->reps, m->warmup,
+		m->budget_ns / 1000000);
+	if (FIXED_POINT)
+		printf("micro: fixed-point raycasting engine (FIXED_POINT=1)\n");
+	printf("%-9s %-38s %3s %11s %11s %11s %6s %11s %12s\n", "kernel",
+		"case", "n", "p50 us", "min us", "mean us", "sd", "p99 us", "p50/item");
+	if (m->csv)
+		fprintf(m->csv, "kernel,case,reps,items,unit,min_ns,p50_ns,mean_ns,"
+			"sd_ns,p99_ns,max_ns,ns_per_item\n");
+}
+
+/**
+ * @brief Point d'entrée des microbenchmarks.
+ *
+ * Chaque noyau du jeu est mesuré isolément, sur des données préparées hors
+ * de la mesure: le DDA, le texturage des murs, le plafond et le sol, les
+ * sprites de l'interface, l'agrandissement de la vue 3D, le chargement des
+ * XPM livrés et l'analyse des fichiers .cub. À lancer depuis la racine du dépôt ('make bench'), pour
+ * que les chemins des textures soient valides.
+ *
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ * @return EXIT_SUCCESS.
+ */
+int	main(int ac, char **av)
+{
+	t_Micro	m;
+
+	ft_bzero(&m, sizeof(t_Micro));
+	micro_options(&m, ac, av);
+	m.times = malloc(sizeof(long long) * m.reps);
+	if (!m.times)
+		return (printf("Error: fatal: cannot allocate timings\n"), 1);
+	micro_fixture(&m);
+	micro_header(&m);
+	micro_dda(&m);
+	micro_texture(&m);
+	micro_blit(&m);
+	micro_upscale(&m);
+	micro_xpm(&m, "textures");
+	micro_xpm(&m, "sprites");
+	micro_parse(&m);
+	if (m.csv)
+		fclose(m.csv);
+	free(m.times);
+	free_main(&m.cub);
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,106 @@
+#include "micro.h"
+
+/**
+ * @brief Affiche l'utilisation des microbenchmarks et termine avec une
+ * erreur.
+ *
+ * @param msg Le message d'erreur à afficher avant l'utilisation.
+ */
+static void	micro_usage(char *msg)
+{
+	printf("Error: %s\n", msg);
+	printf("Usage: ./cub3D_micro [--reps N] [--warmup N] [--budget ms]");
+	printf(" [--map-max KB] [--filter name] [--csv file.csv] [map.cub]\n");
+	exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Lit la valeur numérique qui suit une option.
+ *
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ * @return La valeur entière de l'argument qui suit l'option.
+ */
+static int	micro_value(char **av, int i)
+{
+	if (!ft_isnumeric(av[i + 1]) || ft_atoi(av[i + 1]) < 0)
+		micro_usage("Option expects a non-negative number");
+	return (ft_atoi(av[i + 1]));
+}
+
+/**
+ * @brief Analyse une option et sa valeur.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param av Les arguments de ligne de commande.
+ * @param i L'index de l'option dans 'av'.
+ */
+static void	micro_option(t_Micro *m, char **av, int i)
+{
+	if (!ft_strncmp(av[i], "--reps", 7))
+		m->reps = micro_value(av, i);
+	else if (!ft_strncmp(av[i], "--warmup", 9))
+		m->warmup = micro_value(av, i);
+	else if (!ft_strncmp(av[i], "--budget", 9))
+		m->budget_ns = micro_value(av, i) * 1000000LL;
+	else if (!ft_strncmp(av[i], "--map-max", 10))
+		m->map_max = micro_value(av, i);
+	else if (!ft_strncmp(av[i], "--filter", 9))
+		m->filter = av[i + 1];
+	else if (!ft_strncmp(av[i], "--csv", 6))
+	{
+		m->csv = fopen(av[i + 1], "w");
+		if (!m->csv)
+			micro_usage("Cannot open the CSV file");
+	}
+	else
+		micro_usage("Unknown option");
+}
+
+/**
+ * @brief Analyse la ligne de commande des microbenchmarks.
+ *
+ * Sans argument, chaque cas est répété jusqu'à MICRO_REPS fois après
+ * MICRO_WARMUP répétitions de chauffe, dans un budget de MICRO_BUDGET_MS
+ * millisecondes, sur la carte MICRO_MAP.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param ac Le nombre d'arguments de ligne de commande.
+ * @param av Les arguments de ligne de commande.
+ */
+void	micro_options(t_Micro *m, int ac, char **av)
+{
+	int	i;
+
+	m->map = MICRO_MAP;
+	m->reps = MICRO_REPS;
+	m->warmup = MICRO_WARMUP;
+	m->budget_ns = MICRO_BUDGET_MS * 1000000LL;
+	m->map_max = MICRO_MAP_MAX_KB;
+	i = 1;
+	while (i < ac)
+	{
+		if (av[i][0] != '-')
+			m->map = av[i];
+		else if (i + 1 >= ac)
+			micro_usage("Option expects a value");
+		else
+			micro_option(m, av, i++);
+		i++;
+	}
+	if (m->reps < 1)
+		micro_usage("--reps expects at least 1 repetition");
+}
+
+/**
+ * @brief Indique si un noyau est exclu par '--filter'.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param name Le nom du noyau.
+ * @return 1 si le nom du noyau ne commence pas par le filtre, 0 sinon.
+ */
+int	micro_skip(t_Micro *m, char *name)
+{
+	return (m->filter
+		&& ft_strncmp(name, m->filter, ft_strlen(m->filter)) != 0);
+}
@@ -0,0 +1,142 @@
+#include "micro.h"
+
+/**
+ * @brief Écrit une ligne de la carte générée.
+ *
+ * La première et la dernière ligne sont des murs pleins; les autres sont
+ * vides entre deux murs. Le joueur est placé au centre de la carte.
+ *
+ * @param row Tampon de 'w' + 1 octets pour la ligne.
+ * @param w Largeur de la carte.
+ * @param y L'index de la ligne.
+ * @param rows Le nombre de lignes de la carte.
+ */
+static void	map_row(char *row, int w, long long y, long long rows)
+{
+	ft_memset(row, '0', w);
+	if (!y || y == rows - 1)
+		ft_memset(row, '1', w);
+	row[0] = '1';
+	row[w - 1] = '1';
+	if (y == rows / 2)
+		row[w / 2] = 'N';
+	row[w] = '\n';
+}
+
+/**
+ * @brief Écrit une carte valide d'environ 'size' octets.
+ *
+ * Les informations de textures et de couleurs sont celles des cartes
+ * livrées. La carte est carrée tant que sa largeur reste sous
+ * MICRO_MAP_MAX_W colonnes; au-delà, seules les lignes s'ajoutent.
+ *
+ * @param fd Le descripteur du fichier de la carte.
+ * @param size La taille visée, en octets.
+ * @return La taille du fichier écrit, ou -1 si l'écriture échoue.
+ */
+static long long	map_write(int fd, long long size)
+{
+	char		*row;
+	long long	rows;
+	long long	y;
+	int			w;
+
+	w = sqrt(size);
+	if (w > MICRO_MAP_MAX_W)
+		w = MICRO_MAP_MAX_W;
+	rows = (size - (long long)ft_strlen(MICRO_MAP_HEAD)) / (w + 1);
+	row = malloc(w + 1);
+	if (!row || rows < 3 || write(fd, MICRO_MAP_HEAD,
+			ft_strlen(MICRO_MAP_HEAD)) < 0)
+		return (free(row), -1);
+	y = 0;
+	while (y < rows)
+	{
+		map_row(row, w, y, rows);
+		if (write(fd, row, w + 1) != w + 1)
+			return (free(row), -1);
+		y++;
+	}
+	free(row);
+	return (ft_strlen(MICRO_MAP_HEAD) + rows * (w + 1));
+}
+
+/**
+ * @brief Analyse la carte comme au lancement du jeu, puis la libère.
+ *
+ * Chaque répétition part d'une structure vierge: 'map_init' lit le fichier,
+ * vérifie les informations, remplit la matrice et vérifie que la carte est
+ * fermée.
+ *
+ * @param cub Pointeur vers la structure principale du jeu (inutilisé).
+ * @param arg Le chemin de la carte.
+ */
+static void	parse_kernel(t_Cub3d *cub, void *arg)
+{
+	t_Cub3d	tmp;
+
+	(void)cub;
+	ft_bzero(&tmp, sizeof(t_Cub3d));
+	map_init(&tmp, arg);
+	free_main(&tmp);
+}
+
+/**
+ * @brief Génère une carte temporaire d'environ 'kb' Ko.
+ *
+ * @param path Reçoit le chemin de la carte, au moins 32 octets.
+ * @param kb La taille visée, en Ko.
+ * @return La taille du fichier écrit, ou -1 en cas d'échec.
+ */
+static long long	map_file(char *path, long long kb)
+{
+	long long	size;
+	int			fd;
+
+	ft_strlcpy(path, MICRO_MAP_TMP, 32);
+	fd = mkstemps(path, 4);
+	if (fd < 0)
+		return (-1);
+	size = map_write(fd, kb * 1024);
+	close(fd);
+	if (size < 0)
+		unlink(path);
+	return (size);
+}
+
+/**
+ * @brief Mesure l'analyse de fichiers .cub de 1 Ko à '--map-max' Ko.
+ *
+ * La taille est multipliée par 10 à chaque cas. Les cartes sont générées
+ * dans /tmp et supprimées après leur mesure. Le coût est donné par octet
+ * du fichier.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+void	micro_parse(t_Micro *m)
+{
+	t_MicroCase	c;
+	char		path[32];
+	long long	kb;
+
+	if (micro_skip(m, "parse"))
+		return ;
+	c.name = "parse";
+	c.unit = "B";
+	c.fn = parse_kernel;
+	c.arg = path;
+	kb = 1;
+	while (kb <= m->map_max)
+	{
+		c.items = map_file(path, kb);
+		if (c.items < 0)
+		{
+			printf("Error: Failed writing %s\n", path);
+			return ;
+		}
+		snprintf(c.param, sizeof(c.param), "%lld KB", kb);
+		micro_run(m, &c);
+		unlink(path);
+		kb *= 10;
+	}
+}
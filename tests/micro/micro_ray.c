@@ -0,0 +1,166 @@
+#include "micro.h"
+
+/**
+ * @brief Remplit une ligne de la grille synthétique.
+ *
+ * Les bords de la grille sont des murs; chaque case intérieure est un mur
+ * avec la probabilité 'density' pour cent. Le tirage utilise un générateur
+ * congruentiel linéaire: la même graine donne toujours les mêmes grilles,
+ * d'une exécution et d'une machine à l'autre.
+ *
+ * @param r Pointeur vers les données du microbenchmark du DDA.
+ * @param row La ligne à remplir.
+ * @param y L'index de la ligne dans la grille.
+ * @param density Pourcentage de cases intérieures occupées par un mur.
+ */
+static void	grid_row(t_MicroRays *r, char *row, int y, int density)
+{
+	int	x;
+
+	x = 0;
+	while (x < MICRO_GRID)
+	{
+		r->seed = r->seed * 1103515245 + 12345;
+		row[x] = '0';
+		if (!x || !y || x == MICRO_GRID - 1 || y == MICRO_GRID - 1
+			|| (int)((r->seed >> 16) & 0x7FFF) % 100 < density)
+			row[x] = '1';
+		x++;
+	}
+}
+
+/**
+ * @brief Crée une grille synthétique fermée avec une densité de murs donnée.
+ *
+ * Les murs des bords garantissent que chaque rayon s'arrête. La case
+ * centrale, d'où partent les rayons, reste toujours libre.
+ *
+ * @param r Pointeur vers les données du microbenchmark du DDA.
+ * @param density Pourcentage de cases intérieures occupées par un mur.
+ * @return 0 en cas de succès, 1 si l'allocation échoue.
+ */
+static int	grid_new(t_MicroRays *r, int density)
+{
+	char	**m;
+	int		y;
+
+	r->grid = calloc(1, sizeof(t_MapConfig));
+	m = ft_calloc(MICRO_GRID + 1, sizeof(char *));
+	if (!r->grid || !m)
+		return (free(r->grid), free(m), 1);
+	r->grid->matrix = m;
+	y = 0;
+	while (y < MICRO_GRID)
+	{
+		m[y] = ft_calloc(MICRO_GRID + 1, sizeof(char));
+		if (!m[y])
+			return (ft_free_split(m), free(r->grid), 1);
+		grid_row(r, m[y], y, density);
+		y++;
+	}
+	m[MICRO_GRID / 2][MICRO_GRID / 2] = '0';
+	return (0);
+}
+
+/**
+ * @brief Prépare les rayons de MICRO_POSES directions jusqu'au DDA.
+ *
+ * Depuis le centre de la grille, la caméra tourne par pas réguliers; pour
+ * chaque direction, chaque colonne de l'écran est initialisée comme en jeu
+ * ('init_rays' puis 'step_calculation'); 'step_fixed' prépare aussi le
+ * rayon du moteur FIXED_POINT. La vue de la simulation est restaurée
+ * ensuite.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param r Pointeur vers les données du microbenchmark du DDA.
+ */
+static void	dda_setup(t_Cub3d *cub, t_MicroRays *r)
+{
+	t_SimState	saved;
+	t_SimState	*v;
+	double		angle;
+	int			i;
+
+	v = &cub->sim->view;
+	saved = *v;
+	i = 0;
+	while (i < MICRO_POSES * WINDOW_X)
+	{
+		angle = 2 * M_PI * (i / WINDOW_X) / MICRO_POSES;
+		v->pos_x = MICRO_GRID / 2 + 0.5;
+		v->pos_y = MICRO_GRID / 2 + 0.5;
+		v->dir_x = cos(angle);
+		v->dir_y = sin(angle);
+		v->plane_x = -sin(angle) * cub->cam->fov;
+		v->plane_y = cos(angle) * cub->cam->fov;
+		ray_table_update(cub);
+		init_rays(cub, &r->cams[i], i % WINDOW_X);
+		step_calculation(&r->cams[i], v);
+		step_fixed(&r->cams[i]);
+		i++;
+	}
+	*v = saved;
+}
+
+/**
+ * @brief Parcourt la grille avec tous les rayons préparés.
+ *
+ * @param cub Pointeur vers la structure principale du jeu (inutilisé).
+ * @param arg Pointeur vers les données du microbenchmark du DDA.
+ */
+static void	dda_kernel(t_Cub3d *cub, void *arg)
+{
+	t_MicroRays	*r;
+	int			i;
+
+	(void)cub;
+	r = arg;
+	i = 0;
+	while (i < MICRO_POSES * WINDOW_X)
+	{
+		r->work = r->cams[i];
+		if (FIXED_POINT)
+			dda_fixed(&r->work, r->grid);
+		else
+			apply_dda(&r->work, r->grid);
+		i++;
+	}
+}
+
+/**
+ * @brief Mesure 'apply_dda', ou 'dda_fixed' avec le moteur FIXED_POINT, sur des grilles de plus en plus encombrées.
+ *
+ * Une grille vide fait parcourir aux rayons toute sa largeur; plus la
+ * densité de murs augmente, plus les rayons s'arrêtent tôt. Le coût est
+ * donné par rayon.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+void	micro_dda(t_Micro *m)
+{
+	t_MicroRays	r;
+	t_MicroCase	c;
+	int			density;
+
+	if (micro_skip(m, "dda"))
+		return ;
+	ft_bzero(&r, sizeof(r));
+	r.seed = MICRO_SEED;
+	r.cams = malloc(sizeof(t_CameraConfig) * MICRO_POSES * WINDOW_X);
+	c.name = "dda";
+	c.unit = "ray";
+	c.fn = dda_kernel;
+	c.items = (long long)MICRO_POSES * WINDOW_X;
+	c.arg = &r;
+	density = 0;
+	while (r.cams && density <= MICRO_WALLS_MAX && !grid_new(&r, density))
+	{
+		dda_setup(&m->cub, &r);
+		snprintf(c.param, sizeof(c.param), "walls %d%%", density);
+		micro_run(m, &c);
+		ft_free_split(r.grid->matrix);
+		free(r.grid);
+		density += MICRO_WALLS_STEP;
+	}
+	free(r.cams);
+}
@@ -0,0 +1,135 @@
+#include "micro.h"
+
+/**
+ * @brief Compare deux durées pour le tri avec 'qsort'.
+ *
+ * @param a Pointeur vers la première durée.
+ * @param b Pointeur vers la seconde durée.
+ * @return Un entier négatif, nul ou positif selon l'ordre des durées.
+ */
+static int	cmp_time(const void *a, const void *b)
+{
+	long long	x;
+	long long	y;
+
+	x = *(const long long *)a;
+	y = *(const long long *)b;
+	return ((x > y) - (x < y));
+}
+
+/**
+ * @brief Calcule le résumé statistique des durées mesurées.
+ *
+ * @param t Les durées mesurées (ns), triées par la fonction.
+ * @param n Le nombre de durées.
+ * @param s Reçoit le résumé.
+ */
+static void	micro_stats(long long *t, int n, t_MicroStats *s)
+{
+	double	var;
+	int		i;
+
+	qsort(t, n, sizeof(long long), cmp_time);
+	s->n = n;
+	s->min = t[0];
+	s->p50 = t[n * 50 / 100];
+	s->p99 = t[n * 99 / 100];
+	s->max = t[n - 1];
+	s->mean = 0;
+	i = 0;
+	while (i < n)
+		s->mean += t[i++];
+	s->mean /= n;
+	var = 0;
+	i = 0;
+	while (i < n)
+	{
+		var += (t[i] - s->mean) * (t[i] - s->mean);
+		i++;
+	}
+	s->sd = 0;
+	if (n > 1)
+		s->sd = sqrt(var / (n - 1));
+}
+
+/**
+ * @brief Affiche le résultat d'un cas et l'ajoute au fichier CSV.
+ *
+ * Les durées sont affichées en microsecondes; le coût par élément est
+ * calculé sur la médiane, moins sensible aux interruptions que la moyenne.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param c Le cas mesuré.
+ * @param s Le résumé statistique du cas.
+ */
+static void	micro_report(t_Micro *m, t_MicroCase *c, t_MicroStats *s)
+{
+	double	per_item;
+
+	per_item = (double)s->p50 / c->items;
+	printf("%-9s %-38s %3d %11.3f %11.3f %11.3f %5.1f%% %11.3f %9.2f ns/%s\n",
+		c->name, c->param, s->n, s->p50 / 1e3, s->min / 1e3, s->mean / 1e3,
+		100 * s->sd / s->mean, s->p99 / 1e3, per_item, c->unit);
+	if (!m->csv)
+		return ;
+	fprintf(m->csv, "%s,\"%s\",%d,%lld,%s,%lld,%lld,%.0f,%.0f,%lld,%lld,%.3f\n",
+		c->name, c->param, s->n, c->items, c->unit, s->min, s->p50, s->mean,
+		s->sd, s->p99, s->max, per_item);
+}
+
+/**
+ * @brief Exécute les répétitions de chauffe puis les répétitions mesurées.
+ *
+ * La chauffe remplit les caches et fait charger les pages avant la mesure;
+ * elle s'arrête à la moitié du budget. Les répétitions mesurées s'arrêtent
+ * à 'reps', ou dès que le budget est épuisé une fois MICRO_MIN_REPS
+ * répétitions mesurées, pour que les cas les plus lents restent utilisables.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param c Le cas à mesurer.
+ * @return Le nombre de répétitions mesurées.
+ */
+static int	micro_reps(t_Micro *m, t_MicroCase *c)
+{
+	long long	start;
+	long long	t;
+	int			i;
+
+	start = get_time_ns();
+	i = 0;
+	while (i < m->warmup && get_time_ns() - start < m->budget_ns / 2)
+	{
+		c->fn(&m->cub, c->arg);
+		i++;
+	}
+	start = get_time_ns();
+	i = 0;
+	while (i < m->reps
+		&& (i < MICRO_MIN_REPS || get_time_ns() - start < m->budget_ns))
+	{
+		t = get_time_ns();
+		c->fn(&m->cub, c->arg);
+		m->times[i++] = get_time_ns() - t;
+	}
+	return (i);
+}
+
+/**
+ * @brief Mesure un cas et affiche son résultat.
+ *
+ * La fonction 'micro_run' exécute le cas, calcule le résumé statistique
+ * de ses durées puis l'affiche.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param c Le cas à mesurer.
+ */
+void	micro_run(t_Micro *m, t_MicroCase *c)
+{
+	t_MicroStats	s;
+	int				n;
+
+	n = micro_reps(m, c);
+	micro_stats(m->times, n, &s);
+	micro_report(m, c, &s);
+	fflush(stdout);
+}
@@ -0,0 +1,124 @@
+#include "micro.h"
+
+/**
+ * @brief Place le mur de la colonne à la distance qui donne la hauteur 'lh'.
+ *
+ * Les distances sont imposées en virgule flottante et en virgule fixe, et
+ * la cellule touchée est celle où le rayon atteint cette distance. La
+ * hauteur est ensuite calculée par le moteur choisi à la compilation.
+ *
+ * @param v La vue de la simulation.
+ * @param c La colonne à préparer.
+ * @param lh La hauteur de la colonne de mur à l'écran, en pixels.
+ */
+static void	tex_distance(t_SimState *v, t_CameraConfig *c, int lh)
+{
+	c->ddist_x = 0;
+	c->ddist_y = 0;
+	c->s_dist_x = WINDOW_Y / (lh + 0.5);
+	c->s_dist_y = c->s_dist_x;
+	c->fx.ddist_x = 0;
+	c->fx.ddist_y = 0;
+	c->fx.s_dist_x = fix_from(c->s_dist_x);
+	c->fx.s_dist_y = c->fx.s_dist_x;
+	c->map_x = floor(v->pos_x + c->s_dist_x * c->raydir_x);
+	c->map_y = floor(v->pos_y + c->s_dist_x * c->raydir_y);
+	if (FIXED_POINT)
+		wall_height_fixed(c);
+	else
+		calculate_wall_height(c);
+}
+
+/**
+ * @brief Prépare une colonne de mur de hauteur 'lh' pour chaque colonne de
+ * l'écran.
+ *
+ * Les rayons partent de la pose de départ du joueur comme en jeu; seule la
+ * distance au mur est imposée, pour que le calcul de la hauteur donne la
+ * hauteur demandée. Les colonnes alternent entre murs verticaux et
+ * horizontaux, afin de mesurer les quatre textures et leurs ombrages.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param cams Reçoit les WINDOW_X colonnes préparées.
+ * @param lh La hauteur de la colonne de mur à l'écran, en pixels.
+ * @return Le nombre de pixels de mur à dessiner.
+ */
+static long long	tex_setup(t_Cub3d *cub, t_CameraConfig *cams, int lh)
+{
+	t_CameraConfig	*c;
+	long long		px;
+	int				x;
+
+	px = 0;
+	ray_table_update(cub);
+	x = 0;
+	while (x < WINDOW_X)
+	{
+		c = &cams[x];
+		init_rays(cub, c, x);
+		c->hit = 0;
+		c->side = x % 2;
+		tex_distance(&cub->sim->view, c, lh);
+		get_wall_direction(cub->map, c);
+		px += c->draw_end - c->draw_start;
+		x++;
+	}
+	return (px);
+}
+
+/**
+ * @brief Texture toutes les colonnes préparées.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param arg Les WINDOW_X colonnes préparées par 'tex_setup'.
+ */
+static void	tex_kernel(t_Cub3d *cub, void *arg)
+{
+	t_CameraConfig	*cams;
+	int				x;
+
+	cams = arg;
+	x = 0;
+	while (x < WINDOW_X)
+	{
+		if (FIXED_POINT)
+			texture_fixed(cub, &cams[x], x, cams[x].wall_tex);
+		else
+			apply_texture(cub, &cams[x], x, cams[x].wall_tex);
+		x++;
+	}
+}
+
+/**
+ * @brief Mesure 'apply_texture', ou 'texture_fixed' avec le moteur
+ * FIXED_POINT, pour des murs de plus en plus proches.
+ *
+ * La hauteur des colonnes va de MICRO_TEX_MIN pixels (mur lointain) à
+ * MICRO_TEX_MAX pixels (mur collé à la caméra, rogné à la hauteur de
+ * l'écran). Le coût est donné par pixel de mur dessiné.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+void	micro_texture(t_Micro *m)
+{
+	t_CameraConfig	*cams;
+	t_MicroCase		c;
+	int				lh;
+
+	if (micro_skip(m, "texture"))
+		return ;
+	cams = malloc(sizeof(t_CameraConfig) * WINDOW_X);
+	c.name = "texture";
+	c.unit = "px";
+	c.fn = tex_kernel;
+	c.arg = cams;
+	lh = MICRO_TEX_MIN;
+	while (cams && lh <= MICRO_TEX_MAX)
+	{
+		c.items = tex_setup(&m->cub, cams, lh);
+		snprintf(c.param, sizeof(c.param), "line_height %d", lh);
+		micro_run(m, &c);
+		lh *= 4;
+	}
+	free(cams);
+}
@@ -0,0 +1,46 @@
+#include "micro.h"
+
+/**
+ * @brief Agrandit la vue 3D à la taille de la fenêtre.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param arg Inutilisé.
+ */
+static void	upscale_kernel(t_Cub3d *cub, void *arg)
+{
+	(void)arg;
+	window_upscale(cub);
+}
+
+/**
+ * @brief Mesure l'agrandissement de la vue 3D ('window_upscale').
+ *
+ * Les résolutions 50 % et 25 % passent par la duplication des pixels, 75 %
+ * par l'échantillonnage au plus proche voisin. Le coût est donné par pixel
+ * de la fenêtre écrit; la fenêtre retrouve ensuite sa pleine résolution.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ */
+void	micro_upscale(t_Micro *m)
+{
+	t_MicroCase	c;
+	int			scale;
+
+	if (micro_skip(m, "upscale"))
+		return ;
+	c.name = "upscale";
+	c.unit = "px";
+	c.fn = upscale_kernel;
+	c.arg = NULL;
+	scale = 75;
+	while (scale >= SCALE_MIN)
+	{
+		window_set_scale(m->cub.win, scale);
+		c.items = (long long)m->cub.win->width * m->cub.win->height;
+		snprintf(c.param, sizeof(c.param), "scale %d%% (%dx%d)", scale,
+			m->cub.win->render_w, m->cub.win->render_h);
+		micro_run(m, &c);
+		scale -= SCALE_MIN;
+	}
+	window_set_scale(m->cub.win, 100);
+}
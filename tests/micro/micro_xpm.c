@@ -0,0 +1,99 @@
+#include "micro.h"
+
+/**
+ * @brief Charge un fichier XPM avec MiniLibX puis libère l'image.
+ *
+ * @param cub Pointeur vers la structure principale du jeu.
+ * @param arg Le chemin du fichier XPM.
+ */
+static void	xpm_kernel(t_Cub3d *cub, void *arg)
+{
+	void	*img;
+	int		w;
+	int		h;
+
+	img = mlx_xpm_file_to_image(cub->mlx_ptr, arg, &w, &h);
+	if (img)
+		mlx_destroy_image(cub->mlx_ptr, img);
+}
+
+/**
+ * @brief Mesure le chargement d'un fichier XPM.
+ *
+ * Le fichier est chargé une première fois pour connaître ses dimensions; un
+ * fichier que MiniLibX refuse est signalé et ignoré.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param path Le chemin du fichier XPM.
+ */
+static void	xpm_case(t_Micro *m, char *path)
+{
+	t_MicroCase	c;
+	void		*img;
+	int			w;
+	int			h;
+
+	img = mlx_xpm_file_to_image(m->cub.mlx_ptr, path, &w, &h);
+	if (!img)
+	{
+		printf("Error: Failed loading %s\n", path);
+		return ;
+	}
+	mlx_destroy_image(m->cub.mlx_ptr, img);
+	c.name = "xpm";
+	c.unit = "px";
+	c.fn = xpm_kernel;
+	c.arg = path;
+	c.items = (long long)w * h;
+	snprintf(c.param, sizeof(c.param), "%s", path);
+	micro_run(m, &c);
+}
+
+/**
+ * @brief Indique si un nom de fichier se termine par '.xpm'.
+ *
+ * @param name Le nom du fichier.
+ * @return 1 si le fichier est un XPM, 0 sinon.
+ */
+static int	is_xpm_name(char *name)
+{
+	size_t	len;
+
+	len = ft_strlen(name);
+	return (len > 4 && !ft_strncmp(name + len - 4, ".xpm", 5));
+}
+
+/**
+ * @brief Mesure 'mlx_xpm_file_to_image' sur chaque XPM d'un répertoire.
+ *
+ * Le répertoire est parcouru récursivement, dans l'ordre alphabétique pour
+ * que les résultats de deux exécutions se comparent ligne à ligne. Le coût
+ * est donné par pixel de l'image chargée.
+ *
+ * @param m Pointeur vers la suite de microbenchmarks.
+ * @param dir Le répertoire à parcourir.
+ */
+void	micro_xpm(t_Micro *m, char *dir)
+{
+	struct dirent	**list;
+	char			path[PATH_MAX];
+	int				n;
+	int				i;
+
+	if (micro_skip(m, "xpm"))
+		return ;
+	n = scandir(dir, &list, NULL, alphasort);
+	i = 0;
+	while (i < n)
+	{
+		snprintf(path, PATH_MAX, "%s/%s", dir, list[i]->d_name);
+		if (list[i]->d_name[0] != '.' && is_xpm_name(list[i]->d_name))
+			xpm_case(m, path);
+		else if (list[i]->d_name[0] != '.')
+			micro_xpm(m, path);
+		free(list[i]);
+		i++;
+	}
+	if (n >= 0)
+		free(list);
+}